@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string_view>
+#include <vector>
+
+#include "macros.hpp"
+#include "type_renderer.hpp"
+#include "imgui/imgui.h"
+
+#include "examples/base_types.hpp"
+#include "examples/callbacks.hpp"
+#include "examples/containers.hpp"
+#include "examples/custom.hpp"
+#include "examples/enums.hpp"
+#include "examples/nesting.hpp"
+#include "examples/pair.hpp"
+#include "examples/range.hpp"
+#include "examples/styling.hpp"
+#include "examples/tooltip.hpp"
+
+namespace
+{
+    /// @brief Allocations made through operator new and through the ImGui allocator while counting
+    size_t allocationCount = 0;
+    bool_t counting = false;
+
+    void* Allocate(const size_t size)
+    {
+        if (counting)
+            allocationCount++;
+
+        if (void* const pointer = std::malloc(size != 0 ? size : 1))
+            return pointer;
+
+        throw std::bad_alloc();
+    }
+
+    void* AllocateAligned(const size_t size, const std::align_val_t alignment)
+    {
+        if (counting)
+            allocationCount++;
+
+        // The size of aligned_alloc needs to be a multiple of the alignment
+        const size_t align = static_cast<size_t>(alignment);
+#ifdef _MSC_VER
+        if (void* const pointer = _aligned_malloc(std::max<size_t>(size, 1), align))
+#else
+        if (void* const pointer = std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align))
+#endif
+            return pointer;
+
+        throw std::bad_alloc();
+    }
+
+    void FreeAligned(void* const pointer)
+    {
+#ifdef _MSC_VER
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+}
+
+void* operator new(const size_t size) { return Allocate(size); }
+void* operator new[](const size_t size) { return Allocate(size); }
+void* operator new(const size_t size, const std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new[](const size_t size, const std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+
+void operator delete(void* const pointer) noexcept { std::free(pointer); }
+void operator delete[](void* const pointer) noexcept { std::free(pointer); }
+void operator delete(void* const pointer, size_t) noexcept { std::free(pointer); }
+void operator delete[](void* const pointer, size_t) noexcept { std::free(pointer); }
+void operator delete(void* const pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete[](void* const pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete(void* const pointer, size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete[](void* const pointer, size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
+
+namespace
+{
+    constexpr ImVec2 DisplaySize = ImVec2(1920.f, 1080.f);
+
+    /// @brief Frames rendered before counting, they build the widget states and the caches
+    constexpr size_t WarmupFrames = 10;
+
+    /// @brief Frames over which no allocation is allowed
+    constexpr size_t CountedFrames = 100;
+
+    void Setup()
+    {
+        // ImGui allocations are counted too, its buffers need to stop growing as well
+        ImGui::SetAllocatorFunctions([](const size_t size, void*) { return Allocate(size); }, [](void* const pointer, void*) { std::free(pointer); });
+
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = nullptr;
+        io.DisplaySize = DisplaySize;
+        io.DeltaTime = 1.f / 60.f;
+        io.Fonts->AddFontDefault();
+
+        // The atlas needs to be built before the first frame, there is no renderer backend to do it
+        uint8_t* pixels;
+        int32_t width, height;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+        ImGui::StyleColorsDark();
+    }
+
+    /// @brief Opens the header of a top level member, headers are collapsed by default
+    template <typename ReflectT>
+    void OpenMember(ReflectT* const obj, const char_t* const name)
+    {
+        ImGui::PushID(obj);
+        ImGui::PushID(name);
+        ImGui::GetStateStorage()->SetInt(ImGui::GetID(name), 1);
+        ImGui::PopID();
+        ImGui::PopID();
+    }
+
+    /// @brief Gives the containers a few elements, so that the renderers of the elements are measured too
+    void FillContainers(ContainersExample& obj)
+    {
+        obj.vector = { 1, 2, 3, 4 };
+        obj.arrayStruct = { { 1.f, 2, true, 3 }, { 4.f, 5, false, 6 }, { 7.f, 8, true, 9 } };
+        obj.arrayPair = { { 1.f, true }, { 2.f, false }, { 3.f, true } };
+        obj.deque = { 1.f, 2.f, 3.f, 4.f };
+        obj.list = { "first", "second", "third" };
+        obj.set = { 1, 2, 3, 4 };
+        obj.map = { { "first", 1.f }, { "second", 2.f }, { "third", 3.f } };
+    }
+
+    struct Scenario
+    {
+        const char_t* name;
+
+        /// @brief Renders the example and returns the number of allocations made once it is warmed up
+        std::function<size_t()> run;
+    };
+
+    /// @brief Renders an example in a window covering the whole display, and counts the allocations of the last frames
+    /// @param name Scenario name, each scenario uses its own window so that they don't share any widget state
+    /// @param openMembers Top level members whose header is opened
+    /// @param fill Gives the example its values before the warm-up, nullptr to keep the default constructed ones
+    template <typename ReflectT>
+    Scenario MakeExample(const char_t* const name, const std::vector<const char_t*>& openMembers = {}, void (*const fill)(ReflectT&) = nullptr)
+    {
+        return { name, [=]() -> size_t
+        {
+            ReflectT obj{};
+            if (fill)
+                fill(obj);
+
+            const auto frame = [&]()
+            {
+                ImGui::NewFrame();
+
+                ImGui::SetNextWindowPos(ImVec2(0.f, 0.f));
+                ImGui::SetNextWindowSize(DisplaySize);
+                ImGui::Begin(name);
+
+                for (const char_t* const member : openMembers)
+                    OpenMember(&obj, member);
+
+                TypeRenderer::RenderType(&obj);
+
+                ImGui::End();
+                ImGui::Render();
+            };
+
+            for (size_t i = 0; i < WarmupFrames; i++)
+                frame();
+
+            allocationCount = 0;
+            counting = true;
+            for (size_t i = 0; i < CountedFrames; i++)
+                frame();
+            counting = false;
+
+            return allocationCount;
+        }};
+    }
+
+    std::vector<Scenario> GetScenarios()
+    {
+        return {
+            MakeExample<BaseTypesExample>("examples/base_types"),
+            MakeExample<CallbacksExample>("examples/callbacks"),
+            MakeExample<ContainersExample>("examples/containers", { "vector", "array", "cArray", "arrayStruct", "arrayPair", "deque", "list", "set", "map" }, &FillContainers),
+            MakeExample<CustomExample>("examples/custom"),
+            MakeExample<EnumExample>("examples/enums"),
+            MakeExample<NestingExample>("examples/nesting", { "dataArray" }),
+            MakeExample<PairExample>("examples/pair"),
+            MakeExample<RangeExample>("examples/range"),
+            MakeExample<StylingExample>("examples/styling"),
+            MakeExample<TooltipExample>("examples/tooltip"),
+        };
+    }
+}
+
+/// Checks that rendering the examples doesn't allocate once their widget states and caches are built,
+/// this fails with the number of allocations of every scenario that does
+int main(const int32_t argc, char_t* argv[])
+{
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+
+    Setup();
+
+    bool_t failed = false;
+    for (const Scenario& scenario : GetScenarios())
+    {
+        if (!std::string_view(scenario.name).contains(filter))
+            continue;
+
+        const size_t allocations = scenario.run();
+        std::printf("%-24s %8zu allocations over %zu frames\n", scenario.name, allocations, CountedFrames);
+        failed |= allocations != 0;
+    }
+
+    ImGui::DestroyContext();
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
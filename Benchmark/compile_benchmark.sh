@@ -0,0 +1,69 @@
+#!/usr/bin/env bash
+# Measures the compile time and the object size of a translation unit rendering a generated struct,
+# with the templated engine (RenderType) and with the table driven one (RenderTypeTable)
+#
+# Usage : compile_benchmark.sh [field count...]
+# The compiler is taken from CXX, and extra flags from CXXFLAGS
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+CXX="${CXX:-c++}"
+CXXFLAGS="${CXXFLAGS:--O2}"
+COUNTS=("$@")
+if [ ${#COUNTS[@]} -eq 0 ]; then
+    COUNTS=(50 200 1000)
+fi
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+# Writes a struct with the given number of fields, the field types and attributes cycle so that every renderer is used
+# The second argument is the entry point that is instantiated
+generate()
+{
+    local count=$1
+    local entry=$2
+    local types=("float_t" "int32_t" "bool_t" "std::string" "uint64_t" "std::vector<float_t>" "std::pair<int32_t, float_t>")
+
+    echo '#include "type_renderer.hpp"'
+    echo
+    echo 'struct Generated'
+    echo '{'
+    for ((i = 0; i < count; i++)); do
+        echo "    ${types[i % ${#types[@]}]} field$i{};"
+    done
+    echo '};'
+    echo
+    echo 'REFL_TYPE(Generated)'
+    for ((i = 0; i < count; i++)); do
+        if ((i % 10 == 0)); then
+            echo "    REFL_FIELD(field$i, Reflection::PaddingX(4.f))"
+        elif ((i % 10 == 5)); then
+            echo "    REFL_FIELD(field$i, Reflection::ReadOnly())"
+        else
+            echo "    REFL_FIELD(field$i)"
+        fi
+    done
+    echo 'REFL_END'
+    echo
+    echo "template bool_t TypeRenderer::$entry<Generated>(Generated*, bool_t);"
+}
+
+printf '%-16s %-8s %12s %14s\n' "entry" "fields" "seconds" "object bytes"
+
+for entry in RenderType RenderTypeTable; do
+    for count in "${COUNTS[@]}"; do
+        source="$WORK_DIR/${entry}_$count.cpp"
+        object="$WORK_DIR/${entry}_$count.o"
+        generate "$count" "$entry" > "$source"
+
+        start=$(date +%s.%N)
+        # shellcheck disable=SC2086
+        "$CXX" -std=c++23 $CXXFLAGS -ftemplate-depth=4096 -c "$source" -o "$object" \
+            -I"$ROOT/TypeRenderer/include" -I"$ROOT/TypeRenderer/externals" -I"$ROOT/TypeRenderer/externals/imgui"
+        end=$(date +%s.%N)
+
+        printf '%-16s %-8s %12s %14s\n' "$entry" "$count" "$(awk "BEGIN { printf \"%.2f\", $end - $start }")" "$(stat -c %s "$object")"
+    done
+done
@@ -0,0 +1,384 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#include "macros.hpp"
+#include "type_renderer.hpp"
+#include "imgui/imgui.h"
+
+#include "examples/base_types.hpp"
+#include "examples/callbacks.hpp"
+#include "examples/containers.hpp"
+#include "examples/custom.hpp"
+#include "examples/enums.hpp"
+#include "examples/nesting.hpp"
+#include "examples/pair.hpp"
+#include "examples/range.hpp"
+#include "examples/styling.hpp"
+#include "examples/tooltip.hpp"
+
+/// @brief Scenario with a big vector
+struct VectorScenario
+{
+    std::vector<float_t> values;
+};
+
+REFL_AUTO(
+    type(VectorScenario),
+
+    field(values)
+)
+
+/// @brief Scenario with a big ordered map and a big unordered map
+struct MapScenario
+{
+    std::map<int32_t, float_t> ordered;
+    std::unordered_map<std::string, int32_t> unordered;
+};
+
+REFL_AUTO(
+    type(MapScenario),
+
+    field(ordered),
+    field(unordered)
+)
+
+/// @brief Scenario with nested reflected types, every level is expanded
+template <size_t N>
+struct NestingScenario
+{
+    float_t value = 0.f;
+    int32_t count = 0;
+    std::string name = "Level";
+    NestingScenario<N - 1> child;
+};
+
+template <>
+struct NestingScenario<0>
+{
+    float_t value = 0.f;
+};
+
+REFL_TEMPLATE((size_t N), (NestingScenario<N>))
+    REFL_FIELD(value)
+    REFL_FIELD(count)
+    REFL_FIELD(name)
+    REFL_FIELD(child, Reflection::Expanded())
+REFL_END
+
+REFL_TYPE(NestingScenario<0>)
+    REFL_FIELD(value)
+REFL_END
+
+// Repeats a field declaration 1000 times, with names going from f000 to f999
+#define WIDE_FIELDS_10(X, type, prefix) X(type, prefix##0) X(type, prefix##1) X(type, prefix##2) X(type, prefix##3) X(type, prefix##4) \
+    X(type, prefix##5) X(type, prefix##6) X(type, prefix##7) X(type, prefix##8) X(type, prefix##9)
+#define WIDE_FIELDS_100(X, type, prefix) WIDE_FIELDS_10(X, type, prefix##0) WIDE_FIELDS_10(X, type, prefix##1) WIDE_FIELDS_10(X, type, prefix##2) \
+    WIDE_FIELDS_10(X, type, prefix##3) WIDE_FIELDS_10(X, type, prefix##4) WIDE_FIELDS_10(X, type, prefix##5) WIDE_FIELDS_10(X, type, prefix##6) \
+    WIDE_FIELDS_10(X, type, prefix##7) WIDE_FIELDS_10(X, type, prefix##8) WIDE_FIELDS_10(X, type, prefix##9)
+#define WIDE_FIELDS(X) WIDE_FIELDS_100(X, float_t, f0) WIDE_FIELDS_100(X, float_t, f1) WIDE_FIELDS_100(X, float_t, f2) \
+    WIDE_FIELDS_100(X, int32_t, f3) WIDE_FIELDS_100(X, int32_t, f4) WIDE_FIELDS_100(X, int32_t, f5) WIDE_FIELDS_100(X, bool_t, f6) \
+    WIDE_FIELDS_100(X, bool_t, f7) WIDE_FIELDS_100(X, std::string, f8) WIDE_FIELDS_100(X, uint64_t, f9)
+
+#define WIDE_DECLARE_FIELD(type, name) type name{};
+#define WIDE_REFLECT_FIELD(type, name) REFL_FIELD(name)
+
+/// @brief Scenario with 1000 fields
+struct WideScenario
+{
+    WIDE_FIELDS(WIDE_DECLARE_FIELD)
+};
+
+REFL_TYPE(WideScenario)
+    WIDE_FIELDS(WIDE_REFLECT_FIELD)
+REFL_END
+
+namespace
+{
+    constexpr ImVec2 DisplaySize = ImVec2(1920.f, 1080.f);
+
+    struct Options
+    {
+        size_t frames = 1000;
+        std::string_view filter;
+        bool_t csv = false;
+    };
+
+    struct Result
+    {
+        double_t nanosecondsPerFrame = 0.0;
+        double_t valuesPerFrame = 0.0;
+        size_t peakMemory = 0;
+    };
+
+    /// @brief Resets the peak resident set size of the process, only supported on Linux
+    void ResetPeakMemory()
+    {
+#ifdef __linux__
+        std::ofstream clearRefs("/proc/self/clear_refs");
+        clearRefs << "5";
+#endif
+    }
+
+    /// @brief Gets the peak resident set size of the process in KiB, since the last reset if it is supported
+    size_t GetPeakMemory()
+    {
+#ifdef __linux__
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.starts_with("VmHWM:"))
+                return std::strtoull(line.c_str() + 6, nullptr, 10);
+        }
+
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return static_cast<size_t>(usage.ru_maxrss);
+#else
+        return 0;
+#endif
+    }
+
+    void Setup()
+    {
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = nullptr;
+        io.DisplaySize = DisplaySize;
+        io.DeltaTime = 1.f / 60.f;
+        io.Fonts->AddFontDefault();
+
+        // The atlas needs to be built before the first frame, there is no renderer backend to do it
+        uint8_t* pixels;
+        int32_t width, height;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+        ImGui::StyleColorsDark();
+    }
+
+    /// @brief Opens the header of a top level member, headers are collapsed by default
+    template <typename ReflectT>
+    void OpenMember(ReflectT* const obj, const char_t* const name)
+    {
+        ImGui::PushID(obj);
+        ImGui::PushID(name);
+        ImGui::GetStateStorage()->SetInt(ImGui::GetID(name), 1);
+        ImGui::PopID();
+        ImGui::PopID();
+    }
+
+    /// @brief Renders a type with the templated engine or the table driven one
+    template <typename ReflectT>
+    using RenderFunction = bool_t (*)(ReflectT* obj, bool_t inWindow);
+
+    /// @brief Renders a type in a window covering the whole display
+    /// @param name Scenario name, each scenario uses its own window so that they don't share any widget state
+    /// @param obj Object
+    /// @param openMembers Top level members whose header is opened
+    /// @param options Options
+    /// @param render Entry point rendering the type
+    /// @return Result, the measurements
+    template <typename ReflectT>
+    Result Run(const char_t* const name, ReflectT* const obj, const std::vector<const char_t*>& openMembers, const Options& options,
+        const RenderFunction<ReflectT> render = &TypeRenderer::RenderType<ReflectT>)
+    {
+        Result result;
+
+        const auto frame = [&]() -> size_t
+        {
+            ImGui::NewFrame();
+
+            ImGui::SetNextWindowPos(ImVec2(0.f, 0.f));
+            ImGui::SetNextWindowSize(DisplaySize);
+            ImGui::Begin(name);
+
+            for (const char_t* const member : openMembers)
+                OpenMember(obj, member);
+
+            render(obj, false);
+
+            ImGui::End();
+            ImGui::Render();
+
+            return RenderStatistics::GetCurrentFrame().values;
+        };
+
+        ResetPeakMemory();
+
+        // The first frames build the widget states and the caches
+        for (size_t i = 0; i < 10; i++)
+            frame();
+
+        size_t values = 0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < options.frames; i++)
+            values += frame();
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        const double_t frames = static_cast<double_t>(options.frames);
+        result.nanosecondsPerFrame = static_cast<double_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / frames;
+        result.valuesPerFrame = static_cast<double_t>(values) / frames;
+        result.peakMemory = GetPeakMemory();
+
+        return result;
+    }
+
+    struct Scenario
+    {
+        const char_t* name;
+        std::function<Result(const Options&)> run;
+    };
+
+    template <typename ReflectT>
+    Scenario MakeExample(const char_t* const name, const std::vector<const char_t*>& openMembers = {})
+    {
+        return { name, [=](const Options& options)
+        {
+            ReflectT obj{};
+            return Run(name, &obj, openMembers, options);
+        }};
+    }
+
+    /// @brief Same as MakeExample with the table driven engine, nested reflected types are tree nodes there and stay closed
+    template <typename ReflectT>
+    Scenario MakeTable(const char_t* const name)
+    {
+        return { name, [=](const Options& options)
+        {
+            ReflectT obj{};
+            return Run(name, &obj, {}, options, &TypeRenderer::RenderTypeTable<ReflectT>);
+        }};
+    }
+
+    Scenario MakeVector(const char_t* const name, const size_t size)
+    {
+        return { name, [=](const Options& options)
+        {
+            VectorScenario obj;
+            obj.values.resize(size);
+            for (size_t i = 0; i < size; i++)
+                obj.values[i] = static_cast<float_t>(i);
+
+            return Run(name, &obj, { "values" }, options);
+        }};
+    }
+
+    Scenario MakeMap(const char_t* const name, const size_t size)
+    {
+        return { name, [=](const Options& options)
+        {
+            MapScenario obj;
+            for (size_t i = 0; i < size; i++)
+            {
+                obj.ordered.emplace(static_cast<int32_t>(i), static_cast<float_t>(i));
+                obj.unordered.emplace(std::to_string(i), static_cast<int32_t>(i));
+            }
+
+            return Run(name, &obj, { "ordered", "unordered" }, options);
+        }};
+    }
+
+    std::vector<Scenario> GetScenarios()
+    {
+        return {
+            MakeVector("vector/10k", 10'000),
+            MakeVector("vector/100k", 100'000),
+            MakeVector("vector/1M", 1'000'000),
+            MakeMap("map/10k", 10'000),
+            MakeMap("map/100k", 100'000),
+            MakeExample<NestingScenario<16>>("nesting/16"),
+            MakeExample<WideScenario>("wide/1000"),
+            MakeTable<WideScenario>("table/wide/1000"),
+            MakeTable<NestingScenario<16>>("table/nesting/16"),
+            MakeTable<BaseTypesExample>("table/examples/base_types"),
+            MakeExample<BaseTypesExample>("examples/base_types"),
+            MakeExample<CallbacksExample>("examples/callbacks"),
+            MakeExample<ContainersExample>("examples/containers", { "vector", "array", "cArray", "arrayStruct", "arrayPair", "deque", "list", "set", "map" }),
+            MakeExample<CustomExample>("examples/custom"),
+            MakeExample<EnumExample>("examples/enums"),
+            MakeExample<NestingExample>("examples/nesting", { "dataArray" }),
+            MakeExample<PairExample>("examples/pair"),
+            MakeExample<RangeExample>("examples/range"),
+            MakeExample<StylingExample>("examples/styling"),
+            MakeExample<TooltipExample>("examples/tooltip"),
+        };
+    }
+
+    bool_t ParseOptions(const int32_t argc, char_t* argv[], Options& options)
+    {
+        for (int32_t i = 1; i < argc; i++)
+        {
+            const std::string_view argument = argv[i];
+            if (argument == "--frames" && i + 1 < argc)
+            {
+                options.frames = std::max<size_t>(std::strtoull(argv[++i], nullptr, 10), 1);
+            }
+            else if (argument == "--filter" && i + 1 < argc)
+            {
+                options.filter = argv[++i];
+            }
+            else if (argument == "--csv")
+            {
+                options.csv = true;
+            }
+            else
+            {
+                std::cout << "Usage : " << argv[0] << " [--frames count] [--filter text] [--csv]" << '\n';
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main(const int32_t argc, char_t* argv[])
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+        return EXIT_FAILURE;
+
+    Setup();
+
+    if constexpr (!RenderStatistics::Enabled)
+        std::cerr << "TYPE_RENDERER_STATISTICS isn't defined, the number of rendered values won't be reported" << '\n';
+
+    if (options.csv)
+        std::cout << "scenario,ns_per_frame,values_per_frame,peak_memory_kib" << '\n';
+
+    for (const Scenario& scenario : GetScenarios())
+    {
+        if (!std::string_view(scenario.name).contains(options.filter))
+            continue;
+
+        const Result result = scenario.run(options);
+
+        if (options.csv)
+        {
+            std::cout << scenario.name << ',' << result.nanosecondsPerFrame << ',' << result.valuesPerFrame << ',' << result.peakMemory << '\n';
+        }
+        else
+        {
+            std::printf("%-24s %14.0f ns/frame %10.1f values/frame %10zu KiB peak\n",
+                scenario.name, result.nanosecondsPerFrame, result.valuesPerFrame, result.peakMemory);
+        }
+    }
+
+    ImGui::DestroyContext();
+
+    return EXIT_SUCCESS;
+}
@@ -10,6 +10,8 @@ public:
     bool_t valueBoolChanged = false;
 
     int32_t valueFunction = 0;
+
+    int32_t GetSum() const { return valueBool + valueFunction; }
 };
 
 REFL_AUTO(
@@ -20,5 +22,7 @@ REFL_AUTO(
     field(valueFunction, Reflection::ModifiedCallback<CallbacksExample>([](CallbacksExample* const obj) -> void
     {
         std::cout << "valueFunction was modified : " << obj->valueFunction << std::endl;
-    }))
+    })),
+
+    func(GetSum, property(), Reflection::RefreshRate(2.f))
 );
@@ -18,6 +18,10 @@ public:
     uint16_t cArray[10];
     std::vector<ContainersStructExample> arrayStruct;
     std::vector<std::pair<float_t, bool_t>> arrayPair;
+    std::deque<float_t> deque;
+    std::list<std::string> list;
+    std::set<int32_t> set;
+    std::map<std::string, float_t> map;
 
     void AddedElement(int32_t& element)
     {
@@ -38,8 +42,12 @@ REFL_AUTO(
     type(ContainersExample),
 
     field(vector, Reflection::ContainerAddCallback(&ContainersExample::AddedElement)),
-    field(array, Reflection::PaddingY(20.f), Reflection::PaddingX(20.f)),
+    field(array, Reflection::PaddingY(20.f), Reflection::PaddingX(20.f), Reflection::Summary(8)),
     field(cArray),
-    field(arrayStruct),
-    field(arrayPair)
+    field(arrayStruct, Reflection::PageSize(10)),
+    field(arrayPair),
+    field(deque),
+    field(list),
+    field(set),
+    field(map)
 );
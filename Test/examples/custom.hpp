@@ -19,16 +19,35 @@ bool_t TypeRendererImpl<CustomVector2>::Render(const TypeRenderer::Metadata<Refl
     return ImGui::DragFloat2(metadata.name, &metadata.obj->x);
 }
 
+// Reflected types with 2 to 4 members of the same numeric type can be rendered with a single widget, no implementation is needed
+class FusedVector3
+{
+public:
+    float_t x = 0.f;
+    float_t y = 0.f;
+    float_t z = 0.f;
+};
+
 class CustomExample
 {
 public:
     // Since there is a TypeRendererImpl specification of CustomVector2, it can be reflected like any other type
     CustomVector2 vector;
+    FusedVector3 fusedVector;
 };
 
+REFL_AUTO(
+    type(FusedVector3, Reflection::Fused()),
+
+    field(x),
+    field(y),
+    field(z)
+)
+
 REFL_AUTO(
     type(CustomExample),
 
-    field(vector)
+    field(vector),
+    field(fusedVector)
 )
 
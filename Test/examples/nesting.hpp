@@ -27,6 +27,6 @@ REFL_AUTO(
 REFL_AUTO(
     type(NestingExample),
 
-    field(dataSingle),
+    field(dataSingle, Reflection::Expanded()),
     field(dataArray)
 )
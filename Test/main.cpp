@@ -122,6 +122,14 @@ int main(int, char*[])
         // TypeRenderer::RenderType(&pairExample, true);
         // TypeRenderer::RenderType(&stylingExample, true);
 
+        // RenderStatistics::DisplayOverlay();
+
+        // Undo and redo the edits, the journal needs to be enabled with Journal::SetEnabled(true)
+        // if (ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_Z))
+        //     Journal::Undo();
+        // if (ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_Y))
+        //     Journal::Redo();
+
         PostLoop();
     }
 
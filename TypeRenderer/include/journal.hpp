@@ -0,0 +1,733 @@
+﻿#pragma once
+
+/// @file journal.hpp
+///
+/// @brief Defines the journal of the edits made in the type renderer, which allows undoing and redoing them
+///
+/// The journal is disabled by default, see @c Journal::SetEnabled. Edits are recorded as compact deltas in a ring buffer,
+/// the oldest ones are dropped once it is full. Each delta only keeps the state of the edit that isn't in the object,
+/// so undoing or redoing an edit swaps that state with the current one:
+/// - Trivially copyable members keep their raw bytes
+/// - Strings and other values keep their moved out old value, this includes container elements such as reflected types and nested containers
+/// - Container insertions and removals are kept as operations, with the removed element
+///
+/// Only the edits of members whose address doesn't change are recorded: the members of the top level object and of its nested
+/// reflected types, and the containers among them, whose elements are recorded as a whole. Entries refer to the edited objects by address,
+/// so the objects need to outlive their entries, @c Journal::Clear removes them. Undoing and redoing a step call the NotifyChange and
+/// ModifiedCallback attributes along the path of the edited value, see @c Journal::Notifier.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include "macros.hpp"
+
+/// @namespace Journal
+/// @brief Defines the journal of the edits made in the type renderer, which allows undoing and redoing them
+namespace Journal
+{
+    /// @brief Default number of entries the journal keeps
+    constexpr size_t DefaultCapacity = 1024;
+
+    /// @brief Size up to which the bytes of a raw entry are stored in the entry itself
+    constexpr size_t InlineSize = 16;
+
+    /// @brief Edit that isn't stored as raw bytes
+    ///
+    /// A delta holds the state of its target the object doesn't have, applying it swaps both states,
+    /// so applying it once undoes the edit, and applying it again redoes it
+    class Delta
+    {
+    public:
+        Delta() = default;
+        virtual ~Delta() = default;
+
+        DELETE_COPY_MOVE_OPERATIONS(Delta)
+
+        /// @brief Swaps the state of the target with the stored one
+        virtual void Apply() = 0;
+    };
+
+    /// @brief Locates a value through its address
+    /// @tparam T Value type
+    template <typename T>
+    struct PointerLocator
+    {
+        T* pointer;
+
+        T* operator()() const { return pointer; }
+    };
+
+    /// @brief Locates the value of a map entry through its key
+    /// @tparam ContainerT Map type
+    template <typename ContainerT>
+    struct KeyLocator
+    {
+        ContainerT* container;
+        typename ContainerT::key_type key;
+
+        typename ContainerT::mapped_type* operator()() const
+        {
+            const auto it = container->find(key);
+            return it != container->end() ? &it->second : nullptr;
+        }
+    };
+
+    /// @brief Edit of a value, the old value is moved out of the object
+    /// @tparam T Value type
+    /// @tparam LocatorT Callable returning the address of the value, or nullptr if it doesn't exist anymore
+    template <typename T, typename LocatorT>
+    class ValueDelta final : public Delta
+    {
+    public:
+        ValueDelta(LocatorT locator, T&& value) : m_Locator(std::move(locator)), m_Value(std::move(value)) {}
+
+        void Apply() override
+        {
+            if (T* const target = m_Locator())
+                std::swap(*target, m_Value);
+        }
+
+    private:
+        LocatorT m_Locator;
+        T m_Value;
+    };
+
+    /// @brief Insertion or removal of an element of a sequence container
+    /// @tparam ContainerT Container type
+    template <typename ContainerT>
+    class SequenceDelta final : public Delta
+    {
+    public:
+        /// @param container Container
+        /// @param index Element index, relative to the container once the previous entries of the same step are applied
+        /// @param value Removed element, default constructed for an insertion
+        /// @param present Whether the element is in the container, i.e. whether the operation is an insertion
+        SequenceDelta(ContainerT* const container, const size_t index, typename ContainerT::value_type&& value, const bool_t present)
+            : m_Container(container), m_Index(index), m_Value(std::move(value)), m_Present(present) {}
+
+        void Apply() override
+        {
+            if (m_Index > m_Container->size() || (m_Present && m_Index == m_Container->size()))
+                return;
+
+            const auto it = std::next(m_Container->begin(), static_cast<ptrdiff_t>(m_Index));
+            if (m_Present)
+            {
+                m_Value = std::move(*it);
+                m_Container->erase(it);
+            }
+            else
+            {
+                m_Container->insert(it, std::move(m_Value));
+            }
+
+            m_Present = !m_Present;
+        }
+
+    private:
+        ContainerT* m_Container;
+        size_t m_Index;
+        typename ContainerT::value_type m_Value;
+        bool_t m_Present;
+    };
+
+    /// @brief Insertion or removal of a set element, the element is its own key so it is kept by value
+    /// @tparam ContainerT Set type
+    template <typename ContainerT>
+    class SetElementDelta final : public Delta
+    {
+    public:
+        SetElementDelta(ContainerT* const container, typename ContainerT::key_type value, const bool_t present)
+            : m_Container(container), m_Value(std::move(value)), m_Present(present) {}
+
+        void Apply() override
+        {
+            if (m_Present)
+                m_Container->erase(m_Value);
+            else
+                m_Container->insert(m_Value);
+
+            m_Present = !m_Present;
+        }
+
+    private:
+        ContainerT* m_Container;
+        typename ContainerT::key_type m_Value;
+        bool_t m_Present;
+    };
+
+    /// @brief Insertion or removal of a map entry, a removed entry is kept in its node so its value is never copied
+    /// @tparam ContainerT Map type
+    template <typename ContainerT>
+    class MapEntryDelta final : public Delta
+    {
+    public:
+        /// @param container Map
+        /// @param key Entry key
+        /// @param present Whether the entry is in the map, applying the delta removes it then
+        MapEntryDelta(ContainerT* const container, typename ContainerT::key_type key, const bool_t present)
+            : m_Container(container), m_Key(std::move(key)), m_Present(present) {}
+
+        void Apply() override
+        {
+            if (m_Present)
+                m_Node = m_Container->extract(m_Key);
+            else if (!m_Node.empty())
+                m_Container->insert(std::move(m_Node));
+
+            m_Present = !m_Present;
+        }
+
+    private:
+        ContainerT* m_Container;
+        typename ContainerT::key_type m_Key;
+        typename ContainerT::node_type m_Node;
+        bool_t m_Present;
+    };
+
+    /// @brief Change of a map key or of a set element, the node is moved so the mapped value isn't copied
+    /// @tparam ContainerT Map or set type
+    template <typename ContainerT>
+    class RenameDelta final : public Delta
+    {
+    public:
+        RenameDelta(ContainerT* const container, typename ContainerT::key_type from, typename ContainerT::key_type to)
+            : m_Container(container), m_Current(std::move(to)), m_Other(std::move(from)) {}
+
+        void Apply() override
+        {
+            if (!m_Container->contains(m_Current) || m_Container->contains(m_Other))
+                return;
+
+            auto node = m_Container->extract(m_Current);
+            if constexpr (requires { node.key(); })
+                node.key() = m_Other;
+            else
+                node.value() = m_Other;
+
+            m_Container->insert(std::move(node));
+            std::swap(m_Current, m_Other);
+        }
+
+    private:
+        ContainerT* m_Container;
+        typename ContainerT::key_type m_Current;
+        typename ContainerT::key_type m_Other;
+    };
+
+    /// @brief Called after a step is undone or redone, for the NotifyChange and ModifiedCallback attributes of a member or of a type
+    ///
+    /// The renderer chains the notifiers of the members and types enclosing the value being rendered, recorded entries copy the chain
+    struct Notifier
+    {
+        /// @brief Applies the attributes to the object
+        void (*notify)(void* obj) = nullptr;
+        void* obj = nullptr;
+
+        /// @brief Notifier of the enclosing member or type, nullptr for the outermost one
+        const Notifier* parent = nullptr;
+    };
+
+    /// @brief Gets the innermost notifier of the value being rendered
+    const Notifier* GetNotifier();
+
+    /// @brief Sets the innermost notifier of the value being rendered, the entries recorded while it is set are notified through it
+    /// @param notifier Notifier, its parent is the previous one, nullptr to remove all of them
+    void SetNotifier(const Notifier* notifier);
+
+    /// @brief Checks whether the edits are recorded
+    bool_t IsEnabled();
+
+    /// @brief Enables or disables the recording of the edits, the recorded entries are kept
+    void SetEnabled(bool_t enabled);
+
+    /// @brief Sets the number of entries the journal keeps, this clears the journal
+    void SetCapacity(size_t capacity);
+
+    /// @brief Removes all the entries
+    void Clear();
+
+    /// @brief Gets the number of steps that can be undone
+    size_t GetUndoCount();
+
+    /// @brief Gets the number of steps that can be redone
+    size_t GetRedoCount();
+
+    /// @brief Undoes the last step
+    /// @return bool_t, whether there was a step to undo
+    bool_t Undo();
+
+    /// @brief Redoes the last undone step
+    /// @return bool_t, whether there was a step to redo
+    bool_t Redo();
+
+    /// @brief Records the edit of a trivially copyable member
+    ///
+    /// Consecutive edits of the same member by the same widget on consecutive frames are merged, e.g. while dragging
+    /// 
+    /// @param target Member, it already has its new value
+    /// @param before Bytes of the member before the edit
+    /// @param size Member size
+    /// @param id Widget that made the edit, 0 if the edit is never merged
+    void RecordBytes(void* target, const void* before, size_t size, ImGuiID id);
+
+    /// @brief Records an edit, it is merged with the last one the same way as @c RecordBytes
+    /// @param delta Edit, it was already applied to the target
+    /// @param id Widget that made the edit, 0 if the edit is never merged
+    /// @param grouped Whether the edit is undone and redone together with the previous one, used for batched container operations
+    void Record(std::unique_ptr<Delta> delta, ImGuiID id = 0, bool_t grouped = false);
+
+    /// @brief Gets the number of entries recorded since the program started, merged edits aren't counted
+    size_t GetRecordCount();
+
+    /// @brief Records the edit of a value by a widget
+    ///
+    /// Trivially copyable values are copied before the widget is rendered. Copying a string every frame would be too costly,
+    /// so strings are copied when their widget is activated, text widgets only change once they're active.
+    /// Other copyable values, e.g. reflected elements or nested containers, are rendered with several widgets, some of which change the value
+    /// on the frame they're activated. They are only copied on the frames one of their widgets can be activated, when the mouse is clicked
+    /// inside the rect the value covered on the previous frame or when the navigation activates a widget of the window,
+    /// and the copy is kept until the activated widget changes the value. Other types aren't recorded
+    /// 
+    /// @tparam T Value type
+    template <typename T>
+    class ValueEdit
+    {
+    public:
+        /// @brief Starts the edit, this is called before the widget is rendered
+        /// @param enabled Whether the edit is recorded
+        /// @param value Value
+        ValueEdit(bool_t enabled, const T& value);
+
+        /// @brief Records the edit if the value changed, this is called after the widget is rendered
+        /// @tparam MakeLocatorT Callable returning the locator of the value, a callable returning its address or nullptr if it doesn't exist anymore
+        /// @param value Value
+        /// @param changed Whether the widget changed the value
+        /// @param makeLocator Creates the locator, this is only called when the edit is recorded
+        template <typename MakeLocatorT>
+        void End(const T& value, bool_t changed, const MakeLocatorT& makeLocator);
+
+        DELETE_COPY_MOVE_OPERATIONS(ValueEdit)
+
+    private:
+        static constexpr bool_t IsRaw = std::is_trivially_copyable_v<T>;
+        static constexpr bool_t IsString = std::is_same_v<T, std::string>;
+        static constexpr bool_t IsSnapshot = !IsRaw && !IsString && std::is_copy_constructible_v<T> && std::is_move_assignable_v<T>;
+
+        struct Empty
+        {
+        };
+
+        bool_t m_Enabled;
+        MAYBE_UNUSED std::conditional_t<IsRaw, T, std::conditional_t<IsSnapshot, std::optional<T>, Empty>> m_Before;
+
+        /// @brief Widget that was active before the value was rendered, for snapshots
+        MAYBE_UNUSED ImGuiID m_ActiveId = 0;
+
+        /// @brief Identifier and top left corner of the rect covered by the value, for snapshots
+        MAYBE_UNUSED ImGuiID m_RectId = 0;
+        MAYBE_UNUSED ImVec2 m_RectMin;
+    };
+}
+
+namespace Journal
+{
+    namespace Detail
+    {
+        struct Entry
+        {
+            /// @brief Whether the entry is undone and redone together with the previous one
+            bool_t grouped = false;
+
+            /// @brief Widget that made the edit, and frame of its last edit, used to merge consecutive edits
+            ImGuiID id = 0;
+            int32_t frame = 0;
+
+            /// @brief Raw entries, the bytes of the state the member doesn't have
+            void* target = nullptr;
+            size_t size = 0;
+            std::array<std::byte, InlineSize> inlineBytes{};
+            std::unique_ptr<std::byte[]> heapBytes;
+
+            /// @brief Other entries
+            std::unique_ptr<Delta> delta;
+
+            /// @brief Notifiers of the edited value, innermost first, their parents aren't used
+            std::vector<Notifier> notifiers;
+
+            std::byte* GetBytes() { return heapBytes ? heapBytes.get() : inlineBytes.data(); }
+        };
+
+        struct State
+        {
+            bool_t enabled = false;
+            size_t capacity = DefaultCapacity;
+
+            /// @brief Ring buffer, allocated on the first record
+            std::vector<Entry> entries;
+            size_t first = 0;
+            size_t count = 0;
+
+            /// @brief Number of entries that are applied, the following ones can be redone
+            size_t position = 0;
+
+            /// @brief Number of entries pushed since the program started
+            size_t recorded = 0;
+
+            /// @brief Value of the widget that is active, when it was activated, strings reuse their buffer and other values are kept in their entry
+            ImGuiID pendingId = 0;
+            std::string pending;
+            std::unique_ptr<Delta> pendingDelta;
+
+            /// @brief Innermost notifier of the value being rendered
+            const Notifier* notifier = nullptr;
+        };
+
+        inline State& GetState()
+        {
+            static State state;
+            return state;
+        }
+
+        inline Entry& GetEntry(State& state, const size_t index)
+        {
+            return state.entries[(state.first + index) % state.capacity];
+        }
+
+        inline void Apply(Entry& entry)
+        {
+            if (entry.delta)
+                entry.delta->Apply();
+            else
+                std::swap_ranges(entry.GetBytes(), entry.GetBytes() + entry.size, static_cast<std::byte*>(entry.target));
+        }
+
+        /// @brief Notifies the edited value of an entry, the entries of a step edit the same value so a step is notified once
+        inline void Notify(const Entry& entry)
+        {
+            for (const Notifier& notifier : entry.notifiers)
+                notifier.notify(notifier.obj);
+        }
+
+        /// @brief Gets the rect a value covered on the previous frame, it is kept in the state storage of the window
+        inline ImRect LoadRect(const ImGuiID id)
+        {
+            const ImGuiStorage& storage = *ImGui::GetStateStorage();
+            return ImRect(storage.GetFloat(ImHashStr("##minX", 0, id)), storage.GetFloat(ImHashStr("##minY", 0, id)),
+                storage.GetFloat(ImHashStr("##maxX", 0, id)), storage.GetFloat(ImHashStr("##maxY", 0, id)));
+        }
+
+        inline void StoreRect(const ImGuiID id, const ImRect& rect)
+        {
+            ImGuiStorage& storage = *ImGui::GetStateStorage();
+            storage.SetFloat(ImHashStr("##minX", 0, id), rect.Min.x);
+            storage.SetFloat(ImHashStr("##minY", 0, id), rect.Min.y);
+            storage.SetFloat(ImHashStr("##maxX", 0, id), rect.Max.x);
+            storage.SetFloat(ImHashStr("##maxY", 0, id), rect.Max.y);
+        }
+
+        /// @brief Checks whether a widget of a value can be activated during the frame, by a mouse click inside the rect the value covered
+        /// on the previous frame, or by the navigation in the current window
+        inline bool_t CanActivate(const ImGuiID id)
+        {
+            const ImGuiContext& context = *ImGui::GetCurrentContext();
+            if (context.NavActivateId != 0 && context.NavWindow == context.CurrentWindow)
+                return true;
+
+            if (!std::ranges::any_of(context.IO.MouseClicked, std::identity()))
+                return false;
+
+            const ImRect rect = LoadRect(id);
+            return ImGui::IsMouseHoveringRect(rect.Min, rect.Max, false);
+        }
+
+        inline void ClearPending(State& state)
+        {
+            state.pendingId = 0;
+            state.pendingDelta.reset();
+        }
+
+        /// @brief Checks whether an edit can be merged with the last step, which keeps the state from before both edits then
+        inline bool_t Merge(State& state, const ImGuiID id)
+        {
+            if (id == 0 || state.position == 0 || state.position != state.count)
+                return false;
+
+            // The edit is compared with the first entry of the step, the grouped ones are the copies made by the same edit
+            size_t head = state.position - 1;
+            while (head > 0 && GetEntry(state, head).grouped)
+                head--;
+
+            Entry& last = GetEntry(state, head);
+            const int32_t frame = ImGui::GetFrameCount();
+            if (last.id != id || last.frame < frame - 1)
+                return false;
+
+            last.frame = frame;
+            return true;
+        }
+
+        /// @brief Adds an entry after the applied ones, this drops the entries that could be redone, and the oldest one if the journal is full
+        inline Entry& Push(State& state)
+        {
+            if (state.entries.size() != state.capacity)
+                state.entries.resize(state.capacity);
+
+            for (size_t i = state.position; i < state.count; i++)
+                GetEntry(state, i) = Entry();
+            state.count = state.position;
+
+            if (state.count == state.capacity)
+            {
+                GetEntry(state, 0) = Entry();
+                state.first = (state.first + 1) % state.capacity;
+                state.count--;
+
+                // A step can't start in the middle
+                while (state.count > 0 && GetEntry(state, 0).grouped)
+                {
+                    GetEntry(state, 0) = Entry();
+                    state.first = (state.first + 1) % state.capacity;
+                    state.count--;
+                }
+            }
+
+            Entry& entry = GetEntry(state, state.count);
+            entry.frame = ImGui::GetFrameCount();
+            for (const Notifier* notifier = state.notifier; notifier; notifier = notifier->parent)
+                entry.notifiers.push_back(*notifier);
+            state.count++;
+            state.position = state.count;
+            state.recorded++;
+            return entry;
+        }
+    }
+
+    inline const Notifier* GetNotifier()
+    {
+        return Detail::GetState().notifier;
+    }
+
+    inline void SetNotifier(const Notifier* const notifier)
+    {
+        Detail::GetState().notifier = notifier;
+    }
+
+    inline bool_t IsEnabled()
+    {
+        return Detail::GetState().enabled;
+    }
+
+    inline void SetEnabled(const bool_t enabled)
+    {
+        Detail::GetState().enabled = enabled;
+    }
+
+    inline void SetCapacity(const size_t capacity)
+    {
+        Clear();
+        Detail::GetState().capacity = std::max<size_t>(capacity, 1);
+    }
+
+    inline void Clear()
+    {
+        Detail::State& state = Detail::GetState();
+        state.entries.clear();
+        state.first = 0;
+        state.count = 0;
+        state.position = 0;
+        state.pending.clear();
+        Detail::ClearPending(state);
+    }
+
+    inline size_t GetUndoCount()
+    {
+        Detail::State& state = Detail::GetState();
+
+        size_t steps = 0;
+        for (size_t i = 0; i < state.position; i++)
+            steps += !Detail::GetEntry(state, i).grouped;
+        return steps;
+    }
+
+    inline size_t GetRedoCount()
+    {
+        Detail::State& state = Detail::GetState();
+
+        size_t steps = 0;
+        for (size_t i = state.position; i < state.count; i++)
+            steps += !Detail::GetEntry(state, i).grouped;
+        return steps;
+    }
+
+    inline bool_t Undo()
+    {
+        Detail::State& state = Detail::GetState();
+        if (state.position == 0)
+            return false;
+
+        // The entries of a step are undone in reverse order
+        bool_t grouped;
+        do
+        {
+            state.position--;
+            Detail::Entry& entry = Detail::GetEntry(state, state.position);
+            Detail::Apply(entry);
+
+            // The next edit can't be merged with an entry that was undone and redone
+            entry.id = 0;
+            grouped = entry.grouped;
+        }
+        while (grouped && state.position > 0);
+
+        Detail::Notify(Detail::GetEntry(state, state.position));
+        Detail::ClearPending(state);
+        return true;
+    }
+
+    inline bool_t Redo()
+    {
+        Detail::State& state = Detail::GetState();
+        if (state.position == state.count)
+            return false;
+
+        do
+        {
+            Detail::Apply(Detail::GetEntry(state, state.position));
+            state.position++;
+        }
+        while (state.position < state.count && Detail::GetEntry(state, state.position).grouped);
+
+        Detail::Notify(Detail::GetEntry(state, state.position - 1));
+        Detail::ClearPending(state);
+        return true;
+    }
+
+    inline void RecordBytes(void* const target, const void* const before, const size_t size, const ImGuiID id)
+    {
+        Detail::State& state = Detail::GetState();
+        if (Detail::Merge(state, id))
+            return;
+
+        Detail::Entry& entry = Detail::Push(state);
+        entry.id = id;
+        entry.target = target;
+        entry.size = size;
+        if (size > InlineSize)
+            entry.heapBytes = std::make_unique<std::byte[]>(size);
+        std::memcpy(entry.GetBytes(), before, size);
+    }
+
+    inline void Record(std::unique_ptr<Delta> delta, const ImGuiID id, const bool_t grouped)
+    {
+        Detail::State& state = Detail::GetState();
+        if (!grouped && Detail::Merge(state, id))
+            return;
+
+        Detail::Entry& entry = Detail::Push(state);
+        entry.id = id;
+        entry.grouped = grouped && state.count > 1;
+        entry.delta = std::move(delta);
+    }
+
+    inline size_t GetRecordCount()
+    {
+        return Detail::GetState().recorded;
+    }
+
+    template <typename T>
+    ValueEdit<T>::ValueEdit(const bool_t enabled, MAYBE_UNUSED const T& value)
+        : m_Enabled(enabled && (IsRaw || IsString || IsSnapshot))
+    {
+        if constexpr (IsRaw)
+        {
+            if (m_Enabled)
+                m_Before = value;
+        }
+        else if constexpr (IsSnapshot)
+        {
+            if (m_Enabled)
+            {
+                m_ActiveId = ImGui::GetActiveID();
+                m_RectId = ImGui::GetID(&value);
+                m_RectMin = ImGui::GetCursorScreenPos();
+                if (Detail::CanActivate(m_RectId))
+                    m_Before.emplace(value);
+            }
+        }
+    }
+
+    template <typename T>
+    template <typename MakeLocatorT>
+    void ValueEdit<T>::End(MAYBE_UNUSED const T& value, const bool_t changed, MAYBE_UNUSED const MakeLocatorT& makeLocator)
+    {
+        using LocatorT = decltype(makeLocator());
+
+        if (!m_Enabled)
+            return;
+
+        if constexpr (IsRaw)
+        {
+            if (changed)
+                Record(std::make_unique<ValueDelta<T, LocatorT>>(makeLocator(), std::move(m_Before)), ImGui::GetItemID());
+        }
+        else if constexpr (IsString)
+        {
+            Detail::State& state = Detail::GetState();
+            const ImGuiID id = ImGui::GetItemID();
+
+            if (ImGui::IsItemActivated())
+            {
+                Detail::ClearPending(state);
+                state.pendingId = id;
+                state.pending = value;
+            }
+
+            // Only the first change of an activation is recorded, the entry keeps the value from before all of them
+            if (changed && id != 0 && state.pendingId == id)
+            {
+                state.pendingId = 0;
+                Record(std::make_unique<ValueDelta<T, LocatorT>>(makeLocator(), std::move(state.pending)));
+            }
+        }
+        else if constexpr (IsSnapshot)
+        {
+            Detail::State& state = Detail::GetState();
+            const ImGuiID id = ImGui::GetActiveID();
+
+            // The value covers the rest of the line it starts on, down to its last item
+            const float_t maxY = std::max(ImGui::GetCursorScreenPos().y, ImGui::GetItemRectMax().y);
+            Detail::StoreRect(m_RectId, ImRect(m_RectMin, ImVec2(ImGui::GetCurrentWindow()->WorkRect.Max.x, maxY)));
+
+            if (changed)
+            {
+                // The value was copied on this frame before it changed, or when the widget that changed it was activated,
+                // buttons are released before they report a change so they were active on the previous frame
+                if (m_Before)
+                    Record(std::make_unique<ValueDelta<T, LocatorT>>(makeLocator(), std::move(*m_Before)));
+                else if (state.pendingDelta && (state.pendingId == id || state.pendingId == ImGui::GetCurrentContext()->ActiveIdPreviousFrame))
+                    Record(std::move(state.pendingDelta));
+
+                Detail::ClearPending(state);
+            }
+            else if (m_Before && id != 0 && id != m_ActiveId)
+            {
+                // A widget of the value was activated without changing it, the copy is kept until it does
+                state.pendingId = id;
+                state.pendingDelta = std::make_unique<ValueDelta<T, LocatorT>>(makeLocator(), std::move(*m_Before));
+            }
+        }
+    }
+}
@@ -6,6 +6,7 @@
 ///
 /// @brief Defines utilities for meta programming and template manipulation.
 
+#include <concepts>
 #include <functional>
 #include <map>
 #include <type_traits>
@@ -110,11 +111,50 @@ namespace Meta
     template <typename T>
     constexpr bool_t IsDefaultConstructible = std::is_default_constructible_v<T>;
 
+    /// @brief Checks whether @c T can be copy constructed.
+    /// @tparam T Type
+    template <typename T>
+    constexpr bool_t IsCopyConstructible = std::is_copy_constructible_v<T>;
+
     /// @brief Checks whether @c T can be copied without semantics.
     /// @tparam T Type
     template <typename T>
     constexpr bool_t IsCopyAssignable = std::is_copy_assignable_v<T>;
 
+    /// @brief Checks whether @c T can be copied with a simple memory copy.
+    /// @tparam T Type
+    template <typename T>
+    constexpr bool_t IsTriviallyCopyable = std::is_trivially_copyable_v<T>;
+
+    /// @brief Checks whether two @c T values can be compared with the less than operator.
+    /// @tparam T Type
+    template <typename T>
+    constexpr bool_t IsLessThanComparable = requires (const T& a, const T& b) { { a < b } -> std::convertible_to<bool_t>; };
+
+    /// @brief Checks whether two @c T values can be compared with the equality operator.
+    ///
+    /// Containers and pairs declare their operator whatever their elements are, so their elements need to be comparable too.
+    /// C arrays would only compare their addresses, so they aren't comparable.
+    ///
+    /// @tparam T Type
+    template <typename T>
+    constexpr bool_t IsEqualityComparable = requires (const T& a, const T& b) { { a == b } -> std::convertible_to<bool_t>; };
+
+    template <typename T> requires requires { typename T::value_type; }
+    constexpr bool_t IsEqualityComparable<T> = requires (const T& a, const T& b) { { a == b } -> std::convertible_to<bool_t>; }
+        && IsEqualityComparable<typename T::value_type>;
+
+    template <typename T0, typename T1>
+    constexpr bool_t IsEqualityComparable<std::pair<T0, T1>> = IsEqualityComparable<T0> && IsEqualityComparable<T1>;
+
+    template <typename T, size_t N>
+    constexpr bool_t IsEqualityComparable<T[N]> = false;
+
+    /// @brief Checks whether two @c T values are equal if and only if their bytes are, i.e. @c T has no padding and a single representation per value.
+    /// @tparam T Type
+    template <typename T>
+    constexpr bool_t HasUniqueObjectRepresentations = std::has_unique_object_representations_v<T>;
+
     /// @brief Shorthand for std::enable_fi
     /// @tparam Test Condition
     template <bool_t Test>
@@ -141,6 +181,13 @@ namespace Meta
     template <typename T>
     using RemoveConstSpecifier = std::remove_const_t<T>;
 
+    /// @brief Removes the reference specification from @c T
+    ///
+    /// e.g. if @c T was @c int&, then @c RemoveReferenceSpecifier<T> will be @c int
+    ///
+    template <typename T>
+    using RemoveReferenceSpecifier = std::remove_reference_t<T>;
+
     /// @brief Checks whether the type is a @c std::vector
     template <typename>
     constexpr bool_t IsStdVector = false;
@@ -169,6 +216,13 @@ namespace Meta
     template <typename T0, typename T1>
     constexpr bool_t IsStdPair<std::pair<T0, T1>> = true;
 
+    /// @brief Checks whether @c T is a specialization of the template @c TemplateT
+    template <template <typename...> typename TemplateT, typename T>
+    constexpr bool_t IsSpecializationOf = false;
+
+    template <template <typename...> typename TemplateT, typename... Args>
+    constexpr bool_t IsSpecializationOf<TemplateT, TemplateT<Args...>> = true;
+
     /// @brief Checks if @c T is an integral, numeric type.
     /// 
     /// A native type is one of the following types:
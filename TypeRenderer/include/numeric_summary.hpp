@@ -0,0 +1,314 @@
+﻿#pragma once
+
+/// @file numeric_summary.hpp
+///
+/// @brief Defines the kernels used to summarize the contents of numeric containers.
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TYPE_RENDERER_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "macros.hpp"
+#include "meta_programming.hpp"
+
+/// @namespace NumericSummary
+/// @brief Defines the kernels used to summarize the contents of numeric containers.
+namespace NumericSummary
+{
+    /// @brief Summary of a range of numbers, non finite values are only counted
+    struct Summary
+    {
+        /// @brief Number of elements
+        size_t count = 0;
+        /// @brief Number of NaN and infinite elements
+        size_t nonFinite = 0;
+
+        /// @brief Smallest finite element
+        double_t minimum = 0.0;
+        /// @brief Biggest finite element
+        double_t maximum = 0.0;
+        /// @brief Mean of the finite elements
+        double_t mean = 0.0;
+        /// @brief Standard deviation of the finite elements
+        double_t deviation = 0.0;
+
+        /// @brief Number of finite elements in each bin, the bins evenly split the [minimum, maximum] range
+        std::vector<float_t> histogram;
+    };
+
+    /// @brief Result of the reduction pass
+    struct Reduction
+    {
+        /// @brief Number of NaN and infinite elements
+        size_t nonFinite = 0;
+        /// @brief Smallest finite element
+        double_t minimum = std::numeric_limits<double_t>::infinity();
+        /// @brief Biggest finite element
+        double_t maximum = -std::numeric_limits<double_t>::infinity();
+        /// @brief Sum of the finite elements
+        double_t sum = 0.0;
+    };
+
+    /// @brief Hashes the bytes of a range of numbers, this is only used to detect changes
+    /// @tparam T Element type
+    /// @param data Elements
+    /// @param count Number of elements
+    /// @return uint64_t, the hash
+    template <typename T>
+    uint64_t Hash(const T* data, size_t count);
+
+    /// @brief Computes the minimum, maximum, sum and non finite count of a range of numbers
+    /// @tparam T Element type
+    /// @param data Elements
+    /// @param count Number of elements
+    /// @return Reduction, the result
+    template <typename T>
+    Reduction Reduce(const T* data, size_t count);
+
+    /// @brief Computes the sum of the squared deviations of the finite elements from the mean
+    /// @tparam T Element type
+    /// @param data Elements
+    /// @param count Number of elements
+    /// @param mean Mean of the finite elements
+    /// @return double_t, the sum
+    template <typename T>
+    double_t SquaredDeviation(const T* data, size_t count, double_t mean);
+
+    /// @brief Summarizes a range of numbers
+    /// @tparam T Element type
+    /// @param data Elements
+    /// @param count Number of elements
+    /// @param binCount Number of histogram bins
+    /// @return Summary, the summary
+    template <typename T>
+    Summary Compute(const T* data, size_t count, size_t binCount);
+}
+
+namespace NumericSummary
+{
+    template <typename T>
+    uint64_t Hash(const T* const data, const size_t count)
+    {
+        // Words are loaded 8 bytes at a time, the multiplication mixes each word into the hash
+        constexpr uint64_t prime = 0x100000001B3ull;
+
+        const auto bytes = reinterpret_cast<const uint8_t*>(data);
+        const size_t size = count * sizeof(T);
+
+        uint64_t hash = 0xCBF29CE484222325ull ^ size;
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(uint64_t));
+            hash = (hash ^ word) * prime;
+            hash ^= hash >> 29;
+        }
+
+        for (; i < size; i++)
+            hash = (hash ^ bytes[i]) * prime;
+
+        return hash;
+    }
+
+    template <typename T>
+    Reduction Reduce(const T* const data, const size_t count)
+    {
+        Reduction result;
+        size_t i = 0;
+
+#ifdef TYPE_RENDERER_SSE2
+        if constexpr (Meta::IsSame<T, float_t>)
+        {
+            // Non finite lanes are replaced by neutral values, x - x is only 0 for finite values
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 positiveInfinity = _mm_set1_ps(std::numeric_limits<float_t>::infinity());
+            const __m128 negativeInfinity = _mm_set1_ps(-std::numeric_limits<float_t>::infinity());
+
+            __m128 minimum = positiveInfinity;
+            __m128 maximum = negativeInfinity;
+            // The sums are accumulated in double precision to not lose precision on big containers
+            __m128d sumLow = _mm_setzero_pd();
+            __m128d sumHigh = _mm_setzero_pd();
+
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128 value = _mm_loadu_ps(data + i);
+                const __m128 finite = _mm_cmpeq_ps(_mm_sub_ps(value, value), zero);
+
+                result.nonFinite += static_cast<size_t>(std::popcount(static_cast<uint32_t>(~_mm_movemask_ps(finite) & 0xF)));
+
+                minimum = _mm_min_ps(minimum, _mm_or_ps(_mm_and_ps(finite, value), _mm_andnot_ps(finite, positiveInfinity)));
+                maximum = _mm_max_ps(maximum, _mm_or_ps(_mm_and_ps(finite, value), _mm_andnot_ps(finite, negativeInfinity)));
+
+                const __m128 masked = _mm_and_ps(finite, value);
+                sumLow = _mm_add_pd(sumLow, _mm_cvtps_pd(masked));
+                sumHigh = _mm_add_pd(sumHigh, _mm_cvtps_pd(_mm_movehl_ps(masked, masked)));
+            }
+
+            alignas(16) float_t minimums[4];
+            alignas(16) float_t maximums[4];
+            alignas(16) double_t sums[2];
+            _mm_store_ps(minimums, minimum);
+            _mm_store_ps(maximums, maximum);
+            _mm_store_pd(sums, _mm_add_pd(sumLow, sumHigh));
+
+            for (size_t lane = 0; lane < 4; lane++)
+            {
+                result.minimum = std::min(result.minimum, static_cast<double_t>(minimums[lane]));
+                result.maximum = std::max(result.maximum, static_cast<double_t>(maximums[lane]));
+            }
+            result.sum = sums[0] + sums[1];
+        }
+        else if constexpr (Meta::IsSame<T, double_t>)
+        {
+            const __m128d zero = _mm_setzero_pd();
+            const __m128d positiveInfinity = _mm_set1_pd(std::numeric_limits<double_t>::infinity());
+            const __m128d negativeInfinity = _mm_set1_pd(-std::numeric_limits<double_t>::infinity());
+
+            __m128d minimum = positiveInfinity;
+            __m128d maximum = negativeInfinity;
+            __m128d sum = _mm_setzero_pd();
+
+            for (; i + 2 <= count; i += 2)
+            {
+                const __m128d value = _mm_loadu_pd(data + i);
+                const __m128d finite = _mm_cmpeq_pd(_mm_sub_pd(value, value), zero);
+
+                result.nonFinite += static_cast<size_t>(std::popcount(static_cast<uint32_t>(~_mm_movemask_pd(finite) & 0x3)));
+
+                minimum = _mm_min_pd(minimum, _mm_or_pd(_mm_and_pd(finite, value), _mm_andnot_pd(finite, positiveInfinity)));
+                maximum = _mm_max_pd(maximum, _mm_or_pd(_mm_and_pd(finite, value), _mm_andnot_pd(finite, negativeInfinity)));
+                sum = _mm_add_pd(sum, _mm_and_pd(finite, value));
+            }
+
+            alignas(16) double_t minimums[2];
+            alignas(16) double_t maximums[2];
+            alignas(16) double_t sums[2];
+            _mm_store_pd(minimums, minimum);
+            _mm_store_pd(maximums, maximum);
+            _mm_store_pd(sums, sum);
+
+            result.minimum = std::min(minimums[0], minimums[1]);
+            result.maximum = std::max(maximums[0], maximums[1]);
+            result.sum = sums[0] + sums[1];
+        }
+#endif
+
+        // Remaining elements, and integral types which compilers already vectorize well
+        for (; i < count; i++)
+        {
+            const double_t value = static_cast<double_t>(data[i]);
+            if constexpr (Meta::IsFloatingPoint<T>)
+            {
+                if (!std::isfinite(value))
+                {
+                    result.nonFinite++;
+                    continue;
+                }
+            }
+
+            result.minimum = std::min(result.minimum, value);
+            result.maximum = std::max(result.maximum, value);
+            result.sum += value;
+        }
+
+        return result;
+    }
+
+    template <typename T>
+    double_t SquaredDeviation(const T* const data, const size_t count, const double_t mean)
+    {
+        double_t result = 0.0;
+        size_t i = 0;
+
+#ifdef TYPE_RENDERER_SSE2
+        if constexpr (Meta::IsSame<T, float_t> || Meta::IsSame<T, double_t>)
+        {
+            const __m128d zero = _mm_setzero_pd();
+            const __m128d meanValue = _mm_set1_pd(mean);
+            __m128d sum = _mm_setzero_pd();
+
+            for (; i + 2 <= count; i += 2)
+            {
+                __m128d value;
+                if constexpr (Meta::IsSame<T, float_t>)
+                    value = _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i))));
+                else
+                    value = _mm_loadu_pd(data + i);
+
+                const __m128d finite = _mm_cmpeq_pd(_mm_sub_pd(value, value), zero);
+                const __m128d deviation = _mm_and_pd(finite, _mm_sub_pd(value, meanValue));
+                sum = _mm_add_pd(sum, _mm_mul_pd(deviation, deviation));
+            }
+
+            alignas(16) double_t sums[2];
+            _mm_store_pd(sums, sum);
+            result = sums[0] + sums[1];
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            const double_t value = static_cast<double_t>(data[i]);
+            if constexpr (Meta::IsFloatingPoint<T>)
+            {
+                if (!std::isfinite(value))
+                    continue;
+            }
+
+            result += (value - mean) * (value - mean);
+        }
+
+        return result;
+    }
+
+    template <typename T>
+    Summary Compute(const T* const data, const size_t count, const size_t binCount)
+    {
+        Summary summary;
+        summary.count = count;
+        summary.histogram.resize(binCount);
+
+        const Reduction reduction = Reduce(data, count);
+        summary.nonFinite = reduction.nonFinite;
+
+        const size_t finiteCount = count - reduction.nonFinite;
+        if (finiteCount == 0)
+            return summary;
+
+        summary.minimum = reduction.minimum;
+        summary.maximum = reduction.maximum;
+        summary.mean = reduction.sum / static_cast<double_t>(finiteCount);
+        summary.deviation = std::sqrt(SquaredDeviation(data, count, summary.mean) / static_cast<double_t>(finiteCount));
+
+        if (binCount == 0)
+            return summary;
+
+        // Scattering into the bins doesn't vectorize, this pass is scalar
+        const double_t range = summary.maximum - summary.minimum;
+        const double_t scale = range > 0.0 ? static_cast<double_t>(binCount) / range : 0.0;
+        for (size_t i = 0; i < count; i++)
+        {
+            const double_t value = static_cast<double_t>(data[i]);
+            if constexpr (Meta::IsFloatingPoint<T>)
+            {
+                if (!std::isfinite(value))
+                    continue;
+            }
+
+            const size_t bin = std::min(static_cast<size_t>((value - summary.minimum) * scale), binCount - 1);
+            summary.histogram[bin]++;
+        }
+
+        return summary;
+    }
+}
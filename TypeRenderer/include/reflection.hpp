@@ -52,6 +52,11 @@ namespace Reflection
     template <typename DescriptorT>
     constexpr bool_t IsFunction = refl::trait::is_function_v<DescriptorT>;
 
+    /// @brief Checks if the member descriptor describes a property, a getter marked with the @c property attribute
+    /// @tparam DescriptorT Member descriptor
+    template <typename DescriptorT>
+    constexpr bool_t IsProperty = IsFunction<DescriptorT> && refl::descriptor::is_property(DescriptorT{});
+
     template <typename>
     struct StructGetMemberT
     {
@@ -70,6 +75,28 @@ namespace Reflection
         using Type = Meta::RemoveConstSpecifier<typename refl::field_descriptor<T, N>::value_type>;
     };
 
+    /// @brief Descriptor of a member without any attribute, used to render a member without knowing its actual descriptor
+    /// @tparam T Member type
+    template <typename T>
+    struct PlainDescriptor
+    {
+        static constexpr std::tuple<> attributes{};
+    };
+
+    template <typename T>
+    struct StructGetMemberT<PlainDescriptor<T>>
+    {
+        using Type = T;
+    };
+
+    /// @brief Checks if the descriptor is a PlainDescriptor
+    /// @tparam DescriptorT Descriptor
+    template <typename>
+    constexpr bool_t IsPlainDescriptor = false;
+
+    template <typename T>
+    constexpr bool_t IsPlainDescriptor<PlainDescriptor<T>> = true;
+
     /// @brief Gets the member type declaration, whether it's a field or a function
     /// @tparam DescriptorT Member descriptor
     template <typename DescriptorT>
@@ -81,12 +108,67 @@ namespace Reflection
     template <typename ReflectT>
     constexpr TypeDescriptor<ReflectT> GetTypeInfo() { return refl::reflect<ReflectT>(); }
 
+    /// @brief Attributes whose presence is computed once per descriptor, instead of searching the attributes for each check
+    enum class AttributeFlags : uint32_t
+    {
+        None = 0,
+        ReadOnly = 1 << 0,
+        NotifyChange = 1 << 1,
+        ModifiedCallback = 1 << 2,
+        EnumFlags = 1 << 3,
+        EnumRadioButton = 1 << 4,
+        PageSize = 1 << 5,
+        Summary = 1 << 6,
+        RefreshRate = 1 << 7,
+        Expanded = 1 << 8,
+        PairName = 1 << 9,
+        Tooltip = 1 << 10,
+        DynamicTooltip = 1 << 11,
+        CustomName = 1 << 12,
+        PaddingX = 1 << 13,
+        PaddingY = 1 << 14,
+        StyleColor = 1 << 15,
+        StyleVar = 1 << 16,
+    };
+
+    /// @brief Gets the flag of an attribute type, attributes that depend on the member type, such as Range, don't have one
+    /// @tparam AttributeT Attribute type
+    template <typename AttributeT>
+    constexpr AttributeFlags AttributeFlag = AttributeFlags::None;
+
+    /// @brief Gets the flag of an attribute template
+    /// @tparam AttributeT Attribute template
+    template <template <typename...> typename AttributeT>
+    constexpr AttributeFlags AttributeTemplateFlag = AttributeFlags::None;
+
+    /// @brief Gets the flags of a list of attributes
+    /// @tparam AttributesT Attribute types
+    /// @return AttributeFlags, the flags
+    template <typename... AttributesT>
+    constexpr AttributeFlags GetAttributeFlags(const std::tuple<AttributesT...>&)
+    {
+        return static_cast<AttributeFlags>((0u | ... | static_cast<uint32_t>(AttributeFlag<AttributesT>)));
+    }
+
+    /// @brief Flags of the attributes of a descriptor, this is computed in a single pass over the attributes
+    /// @tparam DescriptorT Descriptor type
+    template <typename DescriptorT>
+    constexpr AttributeFlags AttributeMask = GetAttributeFlags(DescriptorT::attributes);
+
     /// @brief Checks if a descriptor has a specified attribute
     /// @tparam AttributeT Attribute type
     /// @tparam DescriptorT Descriptor type
     /// @return Result
     template <typename AttributeT, typename DescriptorT>
-    constexpr bool_t HasAttribute() { return refl::descriptor::has_attribute<AttributeT, DescriptorT>(DescriptorT{}); }
+    constexpr bool_t HasAttribute()
+    {
+        if constexpr (IsPlainDescriptor<DescriptorT>)
+            return false;
+        else if constexpr (AttributeFlag<AttributeT> != AttributeFlags::None)
+            return static_cast<uint32_t>(AttributeMask<DescriptorT>) & static_cast<uint32_t>(AttributeFlag<AttributeT>);
+        else
+            return refl::descriptor::has_attribute<AttributeT, DescriptorT>(DescriptorT{});
+    }
 
     /// @brief Gets the specified attribute of a descriptor
     /// @tparam AttributeT Attribute type
@@ -94,6 +176,54 @@ namespace Reflection
     /// @return Attribute
     template <typename AttributeT, typename DescriptorT>
     constexpr const AttributeT& GetAttribute() { return refl::descriptor::get_attribute<AttributeT, DescriptorT>(DescriptorT{}); }
+
+    /// @brief Checks if a descriptor has an attribute that is a specialization of the specified template
+    /// @tparam AttributeT Attribute template
+    /// @tparam DescriptorT Descriptor type
+    /// @return Result
+    template <template <typename...> typename AttributeT, typename DescriptorT>
+    constexpr bool_t HasAttribute()
+    {
+        if constexpr (IsPlainDescriptor<DescriptorT>)
+            return false;
+        else if constexpr (AttributeTemplateFlag<AttributeT> != AttributeFlags::None)
+            return static_cast<uint32_t>(AttributeMask<DescriptorT>) & static_cast<uint32_t>(AttributeTemplateFlag<AttributeT>);
+        else
+            return refl::descriptor::has_attribute<AttributeT, DescriptorT>(DescriptorT{});
+    }
+
+    /// @brief Gets the first attribute of a descriptor that is a specialization of the specified template
+    /// @tparam AttributeT Attribute template
+    /// @tparam DescriptorT Descriptor type
+    /// @return Attribute
+    template <template <typename...> typename AttributeT, typename DescriptorT>
+    constexpr const auto& GetAttribute() { return refl::descriptor::get_attribute<AttributeT, DescriptorT>(DescriptorT{}); }
+
+    /// @brief Counts the attributes of a descriptor of the specified type
+    /// @tparam AttributeT Attribute type
+    /// @tparam DescriptorT Descriptor type
+    /// @return size_t, the number of attributes
+    template <typename AttributeT, typename DescriptorT>
+    constexpr size_t CountAttributes()
+    {
+        return std::apply([](const auto&... attributes)
+        {
+            return (size_t{ 0 } + ... + static_cast<size_t>(Meta::IsSame<AttributeT, Meta::RemoveConstSpecifier<Meta::RemoveReferenceSpecifier<decltype(attributes)>>>));
+        }, DescriptorT::attributes);
+    }
+
+    /// @brief Counts the attributes of a descriptor that are specializations of the specified template
+    /// @tparam AttributeT Attribute template
+    /// @tparam DescriptorT Descriptor type
+    /// @return size_t, the number of attributes
+    template <template <typename...> typename AttributeT, typename DescriptorT>
+    constexpr size_t CountAttributes()
+    {
+        return std::apply([](const auto&... attributes)
+        {
+            return (size_t{ 0 } + ... + static_cast<size_t>(Meta::IsSpecializationOf<AttributeT, Meta::RemoveConstSpecifier<Meta::RemoveReferenceSpecifier<decltype(attributes)>>>));
+        }, DescriptorT::attributes);
+    }
 }
 
 namespace Reflection
@@ -202,6 +332,56 @@ namespace Reflection
         constexpr explicit ContainerAddCallback(const FuncT callback) : func(callback) {}
     };
 
+    /// @brief Displays a container one page at a time, only the elements of the current page are rendered
+    struct PageSize : FieldAttribute
+    {
+        /// @brief Number of elements per page
+        size_t size;
+
+        /// @brief Creates a page size
+        /// @param s Number of elements per page
+        constexpr explicit PageSize(const size_t s) : size(s) {}
+    };
+
+    /// @brief Displays a summary of a contiguous numeric container, with statistics and a histogram of its elements
+    struct Summary : FieldAttribute
+    {
+        /// @brief Number of histogram bins
+        size_t binCount;
+
+        /// @brief Creates a summary
+        /// @param bins Number of histogram bins
+        constexpr explicit Summary(const size_t bins = 32) : binCount(bins) {}
+    };
+
+    /// @brief Samples a read only field or a property at most @c rate times per second, the last sampled value is displayed in between
+    struct RefreshRate : MemberAttribute
+    {
+        /// @brief Number of samples per second
+        float_t rate;
+
+        /// @brief Creates a refresh rate
+        /// @param hz Number of samples per second, must be positive
+        consteval explicit RefreshRate(const float_t hz) : rate(hz)
+        {
+            // Throwing isn't a constant expression, so a rate that isn't positive fails to compile
+            if (!(hz > 0.f))
+                throw "The refresh rate needs to be positive";
+        }
+    };
+
+    /// @brief Displays a reflected struct with 2 to 4 members of the same numeric type with a single multi component widget
+    ///
+    /// The struct can't have any other attribute, and neither can its members, since the widget edits all of them at once
+    struct Fused : TypeAttribute
+    {
+    };
+
+    /// @brief Displays a nested reflected member expanded by default, they are collapsed otherwise
+    struct Expanded : FieldAttribute
+    {
+    };
+
     /// @brief Allows to add custom names to the elements of an std::pair
     struct PairName : FieldAttribute
     {
@@ -278,10 +458,15 @@ namespace Reflection
     };
 
     /// @brief Adds style color to an element
+    ///
+    /// The colors of a field need to be set by a single StyleColor attribute
+    /// 
+    /// @tparam Args std::pair types
+    template <typename... Args>
     struct StyleColor : MemberAttribute
     {
-        /// @brief Holds the values
-        std::array<std::optional<uint32_t>, ImGuiCol_COUNT> values;
+        /// @brief Holds the colors that are set, as pairs of ImGuiCol and color
+        std::array<std::pair<ImGuiCol, uint32_t>, sizeof...(Args)> values;
 
         /// @brief Creates style colors, you can set all values here.
         /// 
@@ -293,36 +478,163 @@ namespace Reflection
         /// )
         /// @endcode
         /// 
-        /// @tparam Args std::pair types
         /// @param args Pair of ImGuiCol and uint32_t values
-        template <typename... Args>
-        constexpr explicit StyleColor(Args... args) { ((values[args.first] = args.second), ...); }
+        constexpr explicit StyleColor(Args... args) : values{ std::pair<ImGuiCol, uint32_t>(args.first, args.second)... } {}
     };
 
     /// @brief Adds style values to an element
-    template <typename StyleType>
+    ///
+    /// The values of a field need to be set by a single StyleVar attribute, mixing float and ImVec2 values if needed,
+    /// it can be used along with one @c StyleVar<float_t> and one @c StyleVar<ImVec2> attribute of the former spelling
+    /// 
+    /// @tparam Args std::pair types
+    template <typename... Args>
     struct StyleVar : MemberAttribute
     {
-        static_assert(Meta::IsAny<StyleType, float_t, ImVec2>,
-            "StyleVar attribute can only be used with float or ImVec2 specialization"
+        static_assert((Meta::IsAny<typename Args::second_type, float_t, double_t, ImVec2> && ...),
+            "StyleVar attribute can only be used with float or ImVec2 values"
         );
-        
-        /// @brief Holds the values
-        std::array<std::optional<StyleType>, ImGuiStyleVar_COUNT> values;
+
+        /// @brief Number of float values, double values are stored as floats
+        static constexpr size_t FloatCount = (0 + ... + static_cast<size_t>(!Meta::IsSame<typename Args::second_type, ImVec2>));
+
+        /// @brief Number of ImVec2 values
+        static constexpr size_t VectorCount = sizeof...(Args) - FloatCount;
+
+        /// @brief Number of float values that are set
+        static constexpr size_t floatCount = FloatCount;
+
+        /// @brief Number of ImVec2 values that are set
+        static constexpr size_t vectorCount = VectorCount;
+
+        /// @brief Holds the float values that are set, as pairs of ImGuiStyleVar and value
+        std::array<std::pair<ImGuiStyleVar, float_t>, FloatCount> floatValues{};
+
+        /// @brief Holds the ImVec2 values that are set, as pairs of ImGuiStyleVar and value
+        std::array<std::pair<ImGuiStyleVar, ImVec2>, VectorCount> vectorValues{};
 
         /// @brief Creates style values, you can set all values here.
         /// 
         /// For example :
         /// @code
-        /// StyleVar<float_t>(
+        /// StyleVar(
         ///    std::make_pair(ImGuiStyleVar_ChildRounding, 2.f),
-        ///    std::make_pair(ImGuiStyleVar_TabRounding, 5.f)
+        ///    std::make_pair(ImGuiStyleVar_FramePadding, ImVec2(10.f, 10.f))
         /// )
         /// @endcode
         /// 
-        /// @tparam Args std::pair types
-        /// @param args Pair of ImGuiCol and uint32_t values
-        template <typename... Args>
-        constexpr explicit StyleVar(Args... args) { ((values[args.first] = args.second), ...); }
+        /// @param args Pair of ImGuiStyleVar and float_t or ImVec2 values
+        constexpr explicit StyleVar(Args... args)
+        {
+            size_t floatIndex = 0;
+            size_t vectorIndex = 0;
+            (Add(args, floatIndex, vectorIndex), ...);
+        }
+
+    private:
+        template <typename PairT>
+        constexpr void Add(const PairT& pair, size_t& floatIndex, size_t& vectorIndex)
+        {
+            if constexpr (Meta::IsSame<typename PairT::second_type, ImVec2>)
+                vectorValues[vectorIndex++] = { pair.first, pair.second };
+            else
+                floatValues[floatIndex++] = { pair.first, static_cast<float_t>(pair.second) };
+        }
     };
+
+    /// @brief Adds style values of a single type to an element, kept for the former @c StyleVar<float_t>(...) spelling
+    ///
+    /// The number of values isn't part of the type, so this stores a slot per style var, prefer the spelling without a template argument.
+    /// A field can have one attribute of each type, as it could before
+    /// 
+    /// @tparam StyleType float_t or ImVec2
+    template <typename StyleType> requires Meta::IsAny<StyleType, float_t, ImVec2>
+    struct StyleVar<StyleType> : MemberAttribute
+    {
+        /// @brief Holds the float values that are set, as pairs of ImGuiStyleVar and value
+        std::array<std::pair<ImGuiStyleVar, float_t>, Meta::IsSame<StyleType, float_t> ? ImGuiStyleVar_COUNT : 0> floatValues{};
+
+        /// @brief Holds the ImVec2 values that are set, as pairs of ImGuiStyleVar and value
+        std::array<std::pair<ImGuiStyleVar, ImVec2>, Meta::IsSame<StyleType, ImVec2> ? ImGuiStyleVar_COUNT : 0> vectorValues{};
+
+        /// @brief Number of float values that are set
+        size_t floatCount = 0;
+
+        /// @brief Number of ImVec2 values that are set
+        size_t vectorCount = 0;
+
+        /// @brief Creates style values
+        /// @tparam PairsT std::pair types
+        /// @param args Pair of ImGuiStyleVar and StyleType values
+        template <typename... PairsT>
+        constexpr explicit StyleVar(PairsT... args)
+        {
+            static_assert(sizeof...(PairsT) <= ImGuiStyleVar_COUNT, "StyleVar attribute has more values than there are style vars");
+
+            if constexpr (Meta::IsSame<StyleType, float_t>)
+                ((floatValues[floatCount++] = { args.first, static_cast<float_t>(args.second) }), ...);
+            else
+                ((vectorValues[vectorCount++] = { args.first, args.second }), ...);
+        }
+    };
+}
+
+namespace Reflection
+{
+    template <>
+    constexpr AttributeFlags AttributeFlag<ReadOnly> = AttributeFlags::ReadOnly;
+
+    template <typename ReflectT>
+    constexpr AttributeFlags AttributeFlag<NotifyChange<ReflectT>> = AttributeFlags::NotifyChange;
+
+    template <typename ReflectT>
+    constexpr AttributeFlags AttributeFlag<ModifiedCallback<ReflectT>> = AttributeFlags::ModifiedCallback;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<EnumFlags> = AttributeFlags::EnumFlags;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<EnumRadioButton> = AttributeFlags::EnumRadioButton;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<PageSize> = AttributeFlags::PageSize;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<Summary> = AttributeFlags::Summary;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<RefreshRate> = AttributeFlags::RefreshRate;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<Expanded> = AttributeFlags::Expanded;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<PairName> = AttributeFlags::PairName;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<Tooltip> = AttributeFlags::Tooltip;
+
+    template <typename ReflectT>
+    constexpr AttributeFlags AttributeFlag<DynamicTooltip<ReflectT>> = AttributeFlags::DynamicTooltip;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<CustomName> = AttributeFlags::CustomName;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<PaddingX> = AttributeFlags::PaddingX;
+
+    template <>
+    constexpr AttributeFlags AttributeFlag<PaddingY> = AttributeFlags::PaddingY;
+
+    template <typename... Args>
+    constexpr AttributeFlags AttributeFlag<StyleColor<Args...>> = AttributeFlags::StyleColor;
+
+    template <typename... Args>
+    constexpr AttributeFlags AttributeFlag<StyleVar<Args...>> = AttributeFlags::StyleVar;
+
+    template <>
+    constexpr AttributeFlags AttributeTemplateFlag<StyleColor> = AttributeFlags::StyleColor;
+
+    template <>
+    constexpr AttributeFlags AttributeTemplateFlag<StyleVar> = AttributeFlags::StyleVar;
 }
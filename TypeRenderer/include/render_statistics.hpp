@@ -0,0 +1,222 @@
+﻿#pragma once
+
+/// @file render_statistics.hpp
+///
+/// @brief Defines the counters collected while rendering types
+///
+/// The counters are only collected when @c TYPE_RENDERER_STATISTICS is defined, the collection macros expand to nothing otherwise.
+/// The API stays available in both cases so that calling code doesn't need to check the define.
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "imgui.h"
+#include "macros.hpp"
+
+/// @namespace RenderStatistics
+/// @brief Defines the counters collected while rendering types
+namespace RenderStatistics
+{
+    /// @brief Whether the statistics are collected
+#ifdef TYPE_RENDERER_STATISTICS
+    constexpr bool_t Enabled = true;
+#else
+    constexpr bool_t Enabled = false;
+#endif
+
+    /// @brief Time spent rendering a top level type
+    struct TypeTiming
+    {
+        /// @brief Type name
+        const char_t* name = nullptr;
+        /// @brief Number of times the type was rendered
+        uint32_t calls = 0;
+        /// @brief Time spent rendering the type, in milliseconds
+        double_t milliseconds = 0.0;
+    };
+
+    /// @brief Counters of a frame
+    struct Frame
+    {
+        /// @brief Number of values passed to their type renderer, and of function buttons
+        ///
+        /// This isn't a number of ImGui items, a value can submit several of them, such as the check boxes of enum flags.
+        /// Read only values replayed from their draw memo don't run their renderer, so they aren't counted
+        uint32_t values = 0;
+        /// @brief Number of reflected members visited, including the ones that were skipped because they weren't visible
+        uint32_t members = 0;
+        /// @brief Number of open containers
+        uint32_t containers = 0;
+        /// @brief Number of container elements rendered
+        uint32_t elements = 0;
+        /// @brief Number of ImGui IDs pushed
+        uint32_t ids = 0;
+        /// @brief Number of vertices added to the draw lists by the top level types
+        uint32_t vertices = 0;
+        /// @brief Number of indices added to the draw lists by the top level types
+        uint32_t indices = 0;
+        /// @brief Number of user callbacks called, this includes modified callbacks, container add callbacks and function buttons
+        uint32_t callbacks = 0;
+        /// @brief Time spent in user callbacks, in milliseconds
+        double_t callbackMilliseconds = 0.0;
+        /// @brief Time spent per top level type
+        std::vector<TypeTiming> types;
+    };
+
+    /// @brief Gets the counters of the last complete frame
+    /// @return const Frame&, the counters
+    const Frame& GetLastFrame();
+
+    /// @brief Gets the counters of the frame being rendered
+    /// @return Frame&, the counters
+    Frame& GetCurrentFrame();
+
+    /// @brief Starts a new frame if the ImGui frame changed since the last call, this is called by each top level type
+    void CheckNewFrame();
+
+    /// @brief Adds the time spent rendering a top level type to the current frame
+    /// @param name Type name
+    /// @param milliseconds Time spent
+    void AddTypeTiming(const char_t* name, double_t milliseconds);
+
+    /// @brief Displays the counters of the last complete frame in an overlay window
+    /// @param open Closes the window when set to false, can be null
+    void DisplayOverlay(bool_t* open = nullptr);
+
+    /// @brief Measures the time spent in a scope, and adds it to a counter
+    class ScopedTimer
+    {
+    public:
+        /// @brief Starts measuring
+        /// @param milliseconds Counter receiving the time spent in the scope
+        explicit ScopedTimer(double_t& milliseconds) : m_Milliseconds(milliseconds), m_Start(std::chrono::steady_clock::now()) {}
+
+        ~ScopedTimer()
+        {
+            m_Milliseconds += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - m_Start).count();
+        }
+
+        DELETE_COPY_MOVE_OPERATIONS(ScopedTimer)
+
+    private:
+        double_t& m_Milliseconds;
+        std::chrono::steady_clock::time_point m_Start;
+    };
+}
+
+#ifdef TYPE_RENDERER_STATISTICS
+/// @brief Adds a value to a counter of the current frame
+#define TYPE_RENDERER_STAT_ADD(counter, value) (RenderStatistics::GetCurrentFrame().counter += (value))
+/// @brief Measures the time spent in the rest of the scope as time spent in a user callback
+#define TYPE_RENDERER_STAT_CALLBACK_SCOPE()                                                                       \
+    TYPE_RENDERER_STAT_ADD(callbacks, 1);                                                                         \
+    const RenderStatistics::ScopedTimer callbackTimer(RenderStatistics::GetCurrentFrame().callbackMilliseconds)
+#else
+#define TYPE_RENDERER_STAT_ADD(counter, value)
+#define TYPE_RENDERER_STAT_CALLBACK_SCOPE()
+#endif
+
+namespace RenderStatistics
+{
+    namespace Detail
+    {
+        struct State
+        {
+            int32_t frameCount = -1;
+            Frame current;
+            Frame last;
+        };
+
+        inline State& GetState()
+        {
+            static State state;
+            return state;
+        }
+    }
+
+    inline const Frame& GetLastFrame()
+    {
+        return Detail::GetState().last;
+    }
+
+    inline Frame& GetCurrentFrame()
+    {
+        return Detail::GetState().current;
+    }
+
+    inline void CheckNewFrame()
+    {
+        Detail::State& state = Detail::GetState();
+
+        const int32_t frameCount = ImGui::GetFrameCount();
+        if (state.frameCount == frameCount)
+            return;
+
+        state.frameCount = frameCount;
+        std::swap(state.last, state.current);
+
+        // Keeps the capacity of the timings, the same types are usually rendered every frame
+        std::vector<TypeTiming> types = std::move(state.current.types);
+        types.clear();
+        state.current = Frame();
+        state.current.types = std::move(types);
+    }
+
+    inline void AddTypeTiming(const char_t* const name, const double_t milliseconds)
+    {
+        std::vector<TypeTiming>& types = GetCurrentFrame().types;
+
+        // Type names are static strings, so comparing the pointers is enough
+        for (TypeTiming& timing : types)
+        {
+            if (timing.name == name)
+            {
+                timing.calls++;
+                timing.milliseconds += milliseconds;
+                return;
+            }
+        }
+
+        types.push_back({ .name = name, .calls = 1, .milliseconds = milliseconds });
+    }
+
+    inline void DisplayOverlay(bool_t* const open)
+    {
+        constexpr ImGuiWindowFlags flags = ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing;
+
+        ImGui::SetNextWindowBgAlpha(.75f);
+        if (!ImGui::Begin("Type renderer statistics", open, flags))
+        {
+            ImGui::End();
+            return;
+        }
+
+        if constexpr (!Enabled)
+        {
+            ImGui::TextDisabled("Define TYPE_RENDERER_STATISTICS to collect the statistics");
+            ImGui::End();
+            return;
+        }
+
+        const Frame& frame = GetLastFrame();
+
+        ImGui::Text("Values rendered : %u", frame.values);
+        ImGui::Text("Members : %u", frame.members);
+        ImGui::Text("Containers : %u", frame.containers);
+        ImGui::Text("Elements : %u", frame.elements);
+        ImGui::Text("IDs pushed : %u", frame.ids);
+        ImGui::Text("Vertices : %u", frame.vertices);
+        ImGui::Text("Indices : %u", frame.indices);
+        ImGui::Text("Callbacks : %u (%.3f ms)", frame.callbacks, frame.callbackMilliseconds);
+
+        if (!frame.types.empty())
+        {
+            ImGui::SeparatorText("Types");
+            for (const TypeTiming& timing : frame.types)
+                ImGui::Text("%s : %.3f ms (%u)", timing.name, timing.milliseconds, timing.calls);
+        }
+
+        ImGui::End();
+    }
+}
@@ -0,0 +1,261 @@
+﻿#pragma once
+
+/// @file snapshot.hpp
+///
+/// @brief Defines the channel used to inspect an object that lives on another thread
+///
+/// The thread owning the object publishes copies of it through a triple buffer, the UI thread renders the newest copy,
+/// and turns its edits into commands, which go back to the owner through a single producer single consumer queue.
+/// The owner applies them whenever it suits it, see @c TypeRenderer::RenderSnapshot.
+/// Both sides only use atomic loads, stores and exchanges, neither thread ever waits for the other.
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "macros.hpp"
+
+/// @namespace Snapshot
+/// @brief Defines the channel used to inspect an object that lives on another thread
+namespace Snapshot
+{
+    /// @brief Default number of commands a channel can hold before the owner drains them
+    constexpr size_t DefaultCommandCapacity = 256;
+
+    /// @brief Alignment of the indices shared by both threads, this keeps each of them on its own cache line
+    constexpr size_t CacheLineSize = 64;
+
+    /// @brief Buffer holding the last published value, the writer and the reader each own a slot and exchange them through a third one
+    /// @tparam T Value type, it needs to be default constructible and copy assignable
+    template <typename T>
+    class TripleBuffer
+    {
+    public:
+        TripleBuffer() = default;
+
+        DELETE_COPY_MOVE_OPERATIONS(TripleBuffer)
+
+        /// @brief Gets the slot the writer fills, only the writer thread can call this
+        T& GetBack() { return m_Slots[m_Back]; }
+
+        /// @brief Publishes the back slot, only the writer thread can call this
+        /// @param version Version of the value, it is compared to the one the reader asks for
+        void Publish(uint64_t version);
+
+        /// @brief Gets the slot the reader uses, only the reader thread can call this
+        T& GetFront() { return m_Slots[m_Front]; }
+
+        /// @brief Makes the last published value the front slot if it is recent enough, only the reader thread can call this
+        /// @param minVersion Minimum version of the value
+        /// @return bool_t, whether the front slot changed
+        bool_t Acquire(uint64_t minVersion);
+
+    private:
+        // The shared state holds the index of the middle slot, whether it was published since the reader last acquired it, and its version
+        static constexpr uint64_t IndexMask = 0b11;
+        static constexpr uint64_t PublishedBit = 0b100;
+        static constexpr uint64_t VersionShift = 3;
+
+        std::array<T, 3> m_Slots{};
+        alignas(CacheLineSize) std::atomic<uint64_t> m_Middle = 1;
+        alignas(CacheLineSize) uint64_t m_Back = 0;
+        alignas(CacheLineSize) uint64_t m_Front = 2;
+    };
+
+    /// @brief Fixed size queue with a single producer thread and a single consumer thread
+    /// @tparam T Element type
+    /// @tparam Capacity Number of elements, a power of 2
+    template <typename T, size_t Capacity>
+    class SpscQueue
+    {
+        static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "The capacity of a queue needs to be a power of 2");
+
+    public:
+        SpscQueue() = default;
+
+        DELETE_COPY_MOVE_OPERATIONS(SpscQueue)
+
+        /// @brief Adds an element, only the producer thread can call this
+        /// @param value Element, it is left untouched if the queue is full
+        /// @return bool_t, whether the element was added
+        bool_t Push(T& value);
+
+        /// @brief Removes the oldest element, only the consumer thread can call this
+        /// @param value Receives the element
+        /// @return bool_t, whether there was an element
+        bool_t Pop(T& value);
+
+    private:
+        std::array<T, Capacity> m_Elements{};
+
+        // Each side keeps a copy of the index of the other one, and only reloads it when the queue looks full or empty
+        alignas(CacheLineSize) std::atomic<size_t> m_Head = 0;
+        size_t m_CachedTail = 0;
+        alignas(CacheLineSize) std::atomic<size_t> m_Tail = 0;
+        size_t m_CachedHead = 0;
+    };
+
+    /// @brief Edit of an object, made on a snapshot and applied to the object by its owner
+    /// @tparam ReflectT Object type
+    template <typename ReflectT>
+    class Command
+    {
+    public:
+        Command() = default;
+        virtual ~Command() = default;
+
+        DELETE_COPY_MOVE_OPERATIONS(Command)
+
+        /// @brief Applies the edit, it is called once
+        /// @param obj Object
+        virtual void Apply(ReflectT& obj) = 0;
+
+        /// @brief Gets the edited member
+        /// @return size_t, the index of the member in the change mask of the object, see @c TypeRenderer::ChangeMask
+        virtual size_t GetMember() const = 0;
+    };
+
+    /// @brief Connects the thread owning an object with the UI thread inspecting it
+    ///
+    /// A snapshot is only shown once it contains all the edits the UI sent, so the UI keeps showing its own edits until the owner applied them,
+    /// instead of going back to older values for a few frames
+    /// 
+    /// @tparam ReflectT Object type, it needs to be default constructible and copy assignable
+    /// @tparam Capacity Number of commands that can wait for the owner, edits made while the queue is full are lost
+    template <typename ReflectT, size_t Capacity = DefaultCommandCapacity>
+    class Channel
+    {
+    public:
+        Channel() = default;
+
+        DELETE_COPY_MOVE_OPERATIONS(Channel)
+
+        /// @brief Copies the object to the UI, only the owner thread can call this
+        /// @param obj Object
+        void Publish(const ReflectT& obj);
+
+        /// @brief Applies the commands sent by the UI, only the owner thread can call this
+        /// @param obj Object
+        /// @return size_t, the number of commands applied
+        size_t ApplyCommands(ReflectT& obj);
+
+        /// @brief Gets the snapshot to render, it is the newest one containing all the sent commands, only the UI thread can call this
+        /// @return ReflectT*, the snapshot, nullptr if nothing was published yet
+        ReflectT* Acquire();
+
+        /// @brief Sends a command to the owner, only the UI thread can call this
+        /// @param command Command
+        /// @return bool_t, whether the command was sent, the queue might be full
+        bool_t Send(std::unique_ptr<Command<ReflectT>> command);
+
+    private:
+        TripleBuffer<ReflectT> m_Snapshots;
+        SpscQueue<std::unique_ptr<Command<ReflectT>>, Capacity> m_Commands;
+
+        // Owner side, the number of applied commands is the version of the published snapshots
+        uint64_t m_Applied = 0;
+
+        // UI side
+        alignas(CacheLineSize) uint64_t m_Sent = 0;
+        bool_t m_Acquired = false;
+    };
+
+    template <typename T>
+    void TripleBuffer<T>::Publish(const uint64_t version)
+    {
+        const uint64_t previous = m_Middle.exchange(version << VersionShift | PublishedBit | m_Back, std::memory_order_acq_rel);
+        m_Back = previous & IndexMask;
+    }
+
+    template <typename T>
+    bool_t TripleBuffer<T>::Acquire(const uint64_t minVersion)
+    {
+        uint64_t middle = m_Middle.load(std::memory_order_acquire);
+
+        // The exchange only fails if the writer published in the meantime, in which case the new value is checked
+        while (middle & PublishedBit && middle >> VersionShift >= minVersion)
+        {
+            if (m_Middle.compare_exchange_weak(middle, m_Front, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                m_Front = middle & IndexMask;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <typename T, size_t Capacity>
+    bool_t SpscQueue<T, Capacity>::Push(T& value)
+    {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_CachedHead == Capacity)
+        {
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+            if (tail - m_CachedHead == Capacity)
+                return false;
+        }
+
+        m_Elements[tail & (Capacity - 1)] = std::move(value);
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t Capacity>
+    bool_t SpscQueue<T, Capacity>::Pop(T& value)
+    {
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_CachedTail)
+        {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+            if (head == m_CachedTail)
+                return false;
+        }
+
+        value = std::move(m_Elements[head & (Capacity - 1)]);
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename ReflectT, size_t Capacity>
+    void Channel<ReflectT, Capacity>::Publish(const ReflectT& obj)
+    {
+        m_Snapshots.GetBack() = obj;
+        m_Snapshots.Publish(m_Applied);
+    }
+
+    template <typename ReflectT, size_t Capacity>
+    size_t Channel<ReflectT, Capacity>::ApplyCommands(ReflectT& obj)
+    {
+        size_t count = 0;
+        std::unique_ptr<Command<ReflectT>> command;
+        while (m_Commands.Pop(command))
+        {
+            command->Apply(obj);
+            count++;
+        }
+
+        // Destroying the commands here keeps their values from being freed on the UI thread
+        command.reset();
+        m_Applied += count;
+        return count;
+    }
+
+    template <typename ReflectT, size_t Capacity>
+    ReflectT* Channel<ReflectT, Capacity>::Acquire()
+    {
+        m_Acquired |= m_Snapshots.Acquire(m_Sent);
+        return m_Acquired ? &m_Snapshots.GetFront() : nullptr;
+    }
+
+    template <typename ReflectT, size_t Capacity>
+    bool_t Channel<ReflectT, Capacity>::Send(std::unique_ptr<Command<ReflectT>> command)
+    {
+        if (!m_Commands.Push(command))
+            return false;
+
+        m_Sent++;
+        return true;
+    }
+}
@@ -1,14 +1,38 @@
 ﻿#pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cfloat>
+#include <charconv>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <span>
 #include <stack>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #include "imgui.h"
 #include "imgui_internal.h"
+#include "journal.hpp"
 #include "macros.hpp"
 #include "meta_programming.hpp"
+#include "numeric_summary.hpp"
+#include "snapshot.hpp"
 #include "reflection.hpp"
+#include "render_statistics.hpp"
 #include "imgui/misc/cpp/imgui_stdlib.h"
 #include "magic_enum/include/magic_enum/magic_enum.hpp"
 #include "magic_enum/include/magic_enum/magic_enum_flags.hpp"
@@ -17,6 +41,9 @@
 
 #pragma region Definition
 
+template <typename ReflectT>
+struct FlatMembers;
+
 class TypeRenderer final
 {
     STATIC_CLASS(TypeRenderer)
@@ -26,7 +53,7 @@ public:
     /// @tparam ReflectT Reflected top level type
     /// @tparam MemberT Member type
     /// @tparam DescriptorT Member descriptor type
-    /// @tparam Depth Current rendering recursion depth
+    /// @tparam Depth 0 for members, ElementDepth for the elements of containers and pairs
     template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
     struct Metadata
     {
@@ -40,7 +67,31 @@ public:
         MemberT* obj;
     };
 
+    /// @brief Depth of the elements of containers and pairs, whatever their nesting level
+    ///
+    /// Only members and elements need to be told apart, so nested elements don't instantiate the renderers again
+    static constexpr size_t ElementDepth = 1;
+
+    /// @brief Copy of an element that can't be modified in place, such as a map key or a set element
+    /// @tparam T Element type
+    template <typename T>
+    struct StagedElement
+    {
+        /// @brief Whether an element is being edited
+        bool_t staging = false;
+
+        /// @brief Value of the element when the edit started, identifies the element being edited
+        T original;
+
+        /// @brief Edited value, the container is only modified once the edit is done
+        T edited;
+    };
+
     /// @brief Renders a top level type with all its members
+    ///
+    /// Windows start with a filter box, only the members whose path contains the filter are displayed then, along with their parents.
+    /// Paths are the member names, including CustomName overrides, separated by dots, e.g. @c audio.volume, and are matched case insensitively
+    /// 
     /// @tparam ReflectT Top level type
     /// @param obj Object
     /// @param inWindow Whether to render the type in a specific window, or in the current context
@@ -48,6 +99,78 @@ public:
     template <typename ReflectT>
     static bool_t RenderType(ReflectT* obj, bool_t inWindow = false);
 
+    /// @brief Change mask of a reflected type, with one bit per member, nested reflected types are flattened
+    /// @tparam ReflectT Reflected type
+    template <typename ReflectT>
+    using ChangeMask = std::bitset<FlatMembers<ReflectT>::Count>;
+
+    /// @brief Renders a top level type with all its members, and reports which members have been modified
+    ///
+    /// The index of a member in the mask is given by @c FlatMembers<ReflectT>::IndexOf, a member of a nested reflected type
+    /// is at the index of its parent + 1 + its index in the nested type
+    /// 
+    /// @tparam ReflectT Top level type
+    /// @param obj Object
+    /// @param changes Receives the modified members
+    /// @param inWindow Whether to render the type in a specific window, or in the current context
+    /// @return bool_t, whether any member has been modified
+    template <typename ReflectT>
+    static bool_t RenderType(ReflectT* obj, ChangeMask<ReflectT>& changes, bool_t inWindow = false);
+
+    /// @brief Renders all the members of a reflected type in the current ID scope, used for nested reflected types
+    /// @tparam ReflectT Reflected type
+    /// @param obj Object
+    /// @return bool_t, whether any member has been modified
+    template <typename ReflectT>
+    static bool_t RenderMembers(ReflectT* obj);
+
+    /// @brief Renders a single inspector for several objects of a top level type
+    ///
+    /// The first object is displayed, and members whose value differs in the other objects are marked as mixed.
+    /// An edit is then written to all the objects in a single pass, each object gets the NotifyChange and ModifiedCallback
+    /// attributes of the modified members and of their types, as if it had been edited on its own.
+    /// 
+    /// @tparam ReflectT Top level type
+    /// @param objs Objects, nothing is rendered if it is empty
+    /// @param inWindow Whether to render the type in a specific window, or in the current context
+    /// @return bool_t, whether any member has been modified
+    template <typename ReflectT>
+    static bool_t RenderTypes(std::span<ReflectT*> objs, bool_t inWindow = false);
+
+    /// @brief Renders a top level type with all its members, using the table driven engine
+    ///
+    /// The members of each reflected type are described once by a constant table, which a non templated loop interprets.
+    /// Members are rendered by functions that only depend on their type, so they're shared by all the reflected types,
+    /// and the code generated for a reflected type is mostly its table.
+    /// 
+    /// Functions, members with attributes the table doesn't describe, such as Range or StyleColor, and members using a custom
+    /// TypeRendererImpl specialization, which can use the top level object, go through the templated renderers.
+    /// Changes aren't reported through a ChangeMask.
+    /// 
+    /// @tparam ReflectT Top level type
+    /// @param obj Object
+    /// @param inWindow Whether to render the type in a specific window, or in the current context
+    /// @return bool_t, whether any member has been modified
+    template <typename ReflectT>
+    static bool_t RenderTypeTable(ReflectT* obj, bool_t inWindow = false);
+
+    /// @brief Renders the last snapshot of an object owned by another thread, and sends the edits to that thread
+    ///
+    /// The owner thread calls @c Snapshot::Channel::Publish to copy the object, and @c Snapshot::Channel::ApplyCommands at a point of its choosing.
+    /// Each modified member becomes a command holding its index in the ChangeMask and its new value. Applying it gives the object
+    /// the NotifyChange and ModifiedCallback attributes of the member and of the types along its path, as an edit made in place would.
+    /// These attributes only apply there, they never run on the snapshot while it is rendered on the UI thread.
+    /// 
+    /// Functions and static members belong to the owner thread, so they aren't displayed.
+    /// 
+    /// @tparam ReflectT Top level type
+    /// @tparam Capacity Number of commands the channel holds
+    /// @param channel Channel the owner thread publishes to
+    /// @param inWindow Whether to render the type in a specific window, or in the current context
+    /// @return bool_t, whether any member has been modified, nothing is rendered until the first snapshot is published
+    template <typename ReflectT, size_t Capacity>
+    static bool_t RenderSnapshot(Snapshot::Channel<ReflectT, Capacity>& channel, bool_t inWindow = false);
+
     /// @brief Displays a simple member
     /// @tparam ReflectT Reflected top level type
     /// @tparam MemberT Member type
@@ -57,7 +180,329 @@ public:
     template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
     static bool_t DisplaySimpleMember(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata);
 
+    /// @brief Displays an element that can't be modified in place, such as a map key or a set element
+    ///
+    /// Trivially copyable elements are displayed through a copy, other ones are displayed in place as read only.
+    /// The element is copied to @p staged once the user starts editing it, and the edit is done when the widget is deactivated
+    /// 
+    /// @tparam ReflectT Reflected top level type
+    /// @tparam MemberT Element type
+    /// @tparam DescriptorT Field descriptor type
+    /// @param metadata Element metadata
+    /// @param staged Staged element, shared by all the elements of the container
+    /// @return bool_t, whether the edit is done and @c staged.edited needs to replace the element
+    template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
+    static bool_t DisplayStagedMember(const Metadata<ReflectT, const MemberT, DescriptorT, Depth>& metadata, StagedElement<MemberT>& staged);
+
+    /// @brief Minimum number of elements a container needs to have to display the jump to index field
+    static constexpr size_t JumpToIndexMinSize = 32;
+
+    /// @brief Size of the buffers used to format element labels, big enough to hold any size_t
+    static constexpr size_t LabelBufferSize = 24;
+
+    /// @brief Formats an element index into a label buffer, this doesn't allocate
+    /// @param buffer Label buffer
+    /// @param index Element index
+    /// @return const char_t*, the label
+    static const char_t* FormatIndex(char_t (&buffer)[LabelBufferSize], size_t index);
+
+    /// @brief Displays the navigation of a paged container, the current page is kept in the window storage
+    /// @param size Container size
+    /// @param pageSize Number of elements per page
+    /// @param jumpIndex Index of an element whose page should become the current one, -1 if none
+    /// @return std::pair<size_t, size_t>, the [first, last) range of the elements of the current page
+    static std::pair<size_t, size_t> DisplayPageNavigation(size_t size, size_t pageSize, int32_t jumpIndex);
+
+    /// @brief Displays the summary of a numeric container, it is only computed again when the size or contents of the container change
+    /// @tparam T Element type
+    /// @param data Elements
+    /// @param size Number of elements
+    /// @param binCount Number of histogram bins
+    template <typename T>
+    static void DisplaySummary(const T* data, size_t size, size_t binCount);
+
+    /// @brief Gets a state object associated with an ImGui ID, it persists between frames and is default constructed on first use
+    ///
+    /// States that aren't used for WidgetStateLifetime frames are released, e.g. the ones of collapsed or removed members
+    /// @tparam StateT State type
+    /// @param id ImGui ID
+    /// @return StateT&, the state
+    template <typename StateT>
+    static StateT& GetWidgetState(ImGuiID id);
+
+    /// @brief Releases the state object associated with an ImGui ID, if any
+    /// @tparam StateT State type
+    /// @param id ImGui ID
+    template <typename StateT>
+    static void ReleaseWidgetState(ImGuiID id);
+
+    /// @brief ImGui state of the elements of a container
+    ///
+    /// Each row renders with its own ImGui storage, so everything its widgets store, such as open tree nodes or the state of nested
+    /// containers, is found in it whatever its ID. Removing a row removes all of it at once
+    struct ElementsState
+    {
+        /// @brief Storage of the rows that have any state, by index, or by the ID of their key for maps
+        std::map<size_t, ImGuiStorage> rows;
+
+        /// @brief Storage used by the rows without any state, it's moved to @c rows as soon as a row stores something
+        ImGuiStorage empty;
+
+        /// @brief Storage of the container, restored after each row
+        ImGuiStorage* parent = nullptr;
+
+        /// @brief Row being rendered, and whether it uses the empty storage
+        size_t row = 0;
+        bool_t isEmpty = false;
+    };
+
+    /// @brief Gets the state of the elements of a container, and evicts the state of the elements that no longer exist if it shrunk
+    ///
+    /// This needs to be called in the ID scope of the container, rows are then rendered between PushElementState and PopElementState
+    /// @param size Current container size
+    /// @return ElementsState&, the state of the elements
+    static ElementsState& CheckEvictElementsState(size_t size);
+
+    /// @brief Gets the state of the elements of a container, without evicting anything, for containers whose rows aren't indexed
+    /// @return ElementsState&, the state of the elements
+    static ElementsState& GetElementsState();
+
+    /// @brief Makes the widgets of a row use the storage of the row
+    /// @param state State of the elements
+    /// @param row Row index, or row ID
+    static void PushElementState(ElementsState& state, size_t row);
+
+    /// @brief Restores the storage of the container after a row
+    /// @param state State of the elements
+    static void PopElementState(ElementsState& state);
+
+    /// @brief Checks whether the edits of the member being rendered are recorded in the journal, see journal.hpp
+    ///
+    /// This is only the case for containers, their renderers record their own operations and element edits by index or by key,
+    /// other members are recorded by the type renderer
+    /// 
+    /// @return bool_t, whether the edits are recorded
+    static bool_t IsJournaled();
+
 private:
+    /// @brief Flattened members being rendered, members report their changes to the change mask and are hidden by the member filter
+    struct ChangeContext
+    {
+        /// @brief Change mask, nullptr if the changes aren't reported
+        void* mask = nullptr;
+
+        /// @brief Sets a bit of the change mask
+        void (*set)(void* mask, size_t index) = nullptr;
+
+        /// @brief Index of the first member of the type being rendered
+        size_t offset = 0;
+
+        /// @brief Whether each flattened member matches the member filter, nullptr if the members aren't filtered
+        const uint8_t* visible = nullptr;
+
+        /// @brief Top level objects edited together, an array of pointers to the top level type whose first object is displayed, nullptr if a single object is edited
+        const void* objects = nullptr;
+
+        /// @brief Gets one of the objects edited together from @c objects, which keeps its actual type
+        const void* (*getObject)(const void* objects, size_t index) = nullptr;
+
+        /// @brief Number of objects edited together
+        size_t objectCount = 0;
+
+        /// @brief Whether the edits are recorded in the journal, only the members whose address doesn't change are
+        bool_t journal = false;
+
+        /// @brief Whether the object is a snapshot of an object owned by another thread
+        bool_t snapshot = false;
+
+        /// @brief Whether the members are rendered inside a read only nested reflected type
+        ///
+        /// Their values are disabled one by one, the tree node of the nested type isn't since ImGui ignores the clicks on disabled items
+        bool_t readOnly = false;
+    };
+
+    static ChangeContext& GetChangeContext();
+
+    /// @brief Lowercased paths of the flattened members of a reflected type, indexed like its change mask
+    /// @tparam Count Number of flattened members
+    /// @tparam Size Number of characters of all the paths
+    template <size_t Count, size_t Size>
+    struct MemberPathTable
+    {
+        /// @brief Paths, each one is null terminated
+        std::array<char_t, Size> text{};
+
+        /// @brief Offset of the path of each member in @c text
+        std::array<size_t, Count> offsets{};
+
+        /// @brief Index of the parent of each member, NoParent for the members of the top level type
+        std::array<size_t, Count> parents{};
+    };
+
+    /// @brief Parent index of the members of the top level type in a member path table
+    static constexpr size_t NoParent = std::numeric_limits<size_t>::max();
+
+    template <typename ReflectT>
+    static constexpr size_t GetMemberPathsSize();
+
+    template <typename ReflectT>
+    static constexpr auto CreateMemberPaths();
+
+    template <typename... DescriptorsT>
+    static constexpr void AppendMemberPaths(refl::util::type_list<DescriptorsT...>, std::string& text, std::vector<size_t>& offsets, std::vector<size_t>& parents, std::string_view prefix, size_t parent);
+
+    template <typename DescriptorT>
+    static constexpr void AppendMemberPath(std::string& text, std::vector<size_t>& offsets, std::vector<size_t>& parents, std::string_view prefix, size_t parent);
+
+    static constexpr char_t ToLower(char_t c);
+
+    /// @brief Member filter of a top level type
+    struct MemberFilter
+    {
+        /// @brief Filter text, as typed
+        std::string query;
+
+        /// @brief Whether each flattened member is displayed, because its path matches or it is the parent of a match
+        std::vector<uint8_t> visible;
+
+        /// @brief Number of members whose path matches
+        size_t matches = 0;
+    };
+
+    /// @brief Displays the filter box of a top level type, and starts filtering its members if it isn't empty
+    template <typename ReflectT>
+    static void DisplayMemberFilter();
+
+    /// @brief Matches the query of a member filter against the member paths of a reflected type
+    template <typename ReflectT>
+    static void UpdateMemberFilter(MemberFilter& filter);
+
+    /// @brief Checks whether a member is hidden by the member filter
+    template <typename ReflectT, typename DescriptorT>
+    static bool_t IsFilteredOut();
+
+    /// @brief Checks whether a member of the displayed object has a different value in any of the objects edited together
+    ///
+    /// Containers that can't be compared are reported as mixed, they are copied as a whole to the other objects when they are edited
+    /// @param member Member of the displayed object, the same member of the other objects is found at the same offset
+    /// @return bool_t, whether the value is mixed, false if a single object is edited or if another type can't be compared
+    template <typename MemberT>
+    static bool_t IsMixedValue(const MemberT* member);
+
+    /// @brief Copies the modified members of an object to another one, and applies their NotifyChange and ModifiedCallback attributes to it
+    /// @param source Displayed object
+    /// @param target Object edited together with @p source
+    /// @param changes Modified members of the top level type
+    /// @param offset Index of the first member of @c ReflectT in @p changes
+    /// @param journal Whether the previous values of the target are recorded in the journal, in the step of the edit of @p source
+    /// @return bool_t, whether any member has been copied
+    template <typename ReflectT, size_t Count>
+    static bool_t CopyChangedMembers(const ReflectT& source, ReflectT& target, const std::bitset<Count>& changes, size_t offset, bool_t journal);
+
+    template <typename ReflectT, typename... DescriptorsT, size_t Count>
+    static bool_t CopyChangedMembers(refl::util::type_list<DescriptorsT...>, const ReflectT& source, ReflectT& target, const std::bitset<Count>& changes,
+        size_t offset, bool_t journal);
+
+    template <typename ReflectT, typename DescriptorT, size_t Count>
+    static bool_t CopyChangedMember(const ReflectT& source, ReflectT& target, const std::bitset<Count>& changes, size_t offset, bool_t journal);
+
+    /// @brief Applies the NotifyChange and ModifiedCallback attributes of a member after it changed
+    template <typename ReflectT, typename DescriptorT>
+    static void NotifyMemberChanged(ReflectT& obj);
+
+    /// @brief Command writing a member of a snapshotted object
+    /// @tparam ReflectT Top level type
+    /// @tparam DescriptorsT Path of the member, the descriptors going from the top level type to the member
+    template <typename ReflectT, typename... DescriptorsT>
+    class MemberCommand;
+
+    /// @brief Sends the modified members of a snapshot to its owner, one command per member, the members of nested reflected types are sent one by one
+    /// @tparam PathT Descriptors going from the top level type to @c ReflectT
+    /// @param snapshot Object of the snapshot, the top level object or a nested one
+    /// @param changes Modified members of the top level type
+    /// @param offset Index of the first member of @c ReflectT in @p changes
+    /// @param channel Channel
+    template <typename TopT, size_t Capacity, typename ReflectT, typename... PathT, typename... DescriptorsT>
+    static void SendChangedMembers(refl::util::type_list<DescriptorsT...>, refl::util::type_list<PathT...>, const ReflectT& snapshot,
+        const ChangeMask<TopT>& changes, size_t offset, Snapshot::Channel<TopT, Capacity>& channel);
+
+    template <typename TopT, size_t Capacity, typename DescriptorT, typename ReflectT, typename... PathT>
+    static void SendChangedMember(refl::util::type_list<PathT...>, const ReflectT& snapshot, const ChangeMask<TopT>& changes, size_t offset,
+        Snapshot::Channel<TopT, Capacity>& channel);
+
+    /// @brief Geometry recorded for a read only member, it is replayed as long as the member and its layout inputs don't change
+    struct DrawMemo
+    {
+        /// @brief Whether the geometry can be replayed
+        bool_t valid = false;
+
+        /// @brief Hash of the member value, and of the attribute values the widget depends on
+        uint64_t hash = 0;
+
+        /// @brief Layout inputs
+        float_t availableWidth = 0.f;
+        float_t fontSize = 0.f;
+        ImU32 textColor = 0;
+
+        /// @brief Draw command the geometry was recorded in, replaying it in another one would use the wrong texture or clipping
+        ImTextureID textureId = {};
+        ImVec4 clipRect;
+
+        /// @brief Size of the member
+        ImVec2 size;
+
+        /// @brief Vertices, relative to the cursor position
+        std::vector<ImDrawVert> vertices;
+
+        /// @brief Indices, relative to the first vertex
+        std::vector<ImDrawIdx> indices;
+    };
+
+    /// @brief Displays a read only member, its draw commands are recorded and replayed in the next frames instead of running the widgets again
+    template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
+    static void DisplayMemoizedMember(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata);
+
+    /// @brief Displays a read only member whose hash is already known
+    template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
+    static void DisplayMemoizedMember(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata, uint64_t hash);
+
+    /// @brief Hashes the value of a memoizable member
+    template <typename MemberT>
+    static uint64_t HashMember(const MemberT& member);
+
+    /// @brief Displays a read only value through a copy, it is only sampled again as often as the RefreshRate attribute allows
+    /// @tparam ValueT Value type
+    /// @tparam SampleT Callable returning the current value
+    /// @param topLevelObj Top level object
+    /// @param name Member name
+    /// @param sample Reads the current value
+    template <typename ReflectT, typename ValueT, typename DescriptorT, size_t Depth, typename SampleT>
+    static void DisplaySampledMember(ReflectT* topLevelObj, const char_t* name, const SampleT& sample);
+
+    /// @brief Number of frames a widget state is kept without being used, it is released between this many frames and twice as many
+    static constexpr int32_t WidgetStateLifetime = 600;
+
+    /// @brief Widget states of a given type
+    template <typename StateT>
+    struct WidgetStates
+    {
+        struct Entry
+        {
+            StateT state;
+
+            /// @brief Last frame the state was used in
+            int32_t frame = 0;
+        };
+
+        std::unordered_map<ImGuiID, Entry> entries;
+
+        /// @brief Frame of the last collection of the unused states
+        int32_t collectionFrame = 0;
+    };
+
+    template <typename StateT>
+    static WidgetStates<StateT>& GetWidgetStates();
+
     template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
     static Metadata<ReflectT, MemberT, DescriptorT, Depth> CreateMetadata(ReflectT* obj);
 
@@ -67,9 +512,16 @@ private:
     template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
     static MemberT* GetMemberPointer(ReflectT* obj);
     
+    /// @brief Minimum number of members a type needs to have for the members outside of the clip rectangle to be skipped
+    static constexpr size_t MemberCullingMinCount = 32;
+
     template <typename ReflectT, bool_t IsStatic>
     static bool_t DisplayMembers(ReflectT* obj);
 
+    /// @brief Estimates the height of a member that was never displayed, it is replaced by the measured height once it is
+    template <typename MemberT, typename DescriptorT>
+    static float_t EstimateMemberHeight();
+
     template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth, bool_t IsStatic>
     static bool_t DisplayField(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata, bool_t& hasStatic);
 
@@ -79,16 +531,142 @@ private:
     template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
     static void CheckDisplayTooltip(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata);
 
-    template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
-    _NODISCARD static std::pair<int32_t, int32_t> CheckUpdateStyle(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata);
+    /// @brief Top level object type of the members rendered from a member table, their renderers don't know the actual type
+    struct ErasedObject
+    {
+    };
+
+    /// @brief Entry of a member table, see RenderTypeTable
+    struct MemberEntry
+    {
+        /// @brief Display name
+        const char_t* name = nullptr;
+
+        /// @brief Whether the member is static, static members are displayed after the other ones
+        bool_t isStatic = false;
+
+        /// @brief Whether the member is const or has the ReadOnly attribute
+        bool_t readOnly = false;
+
+        /// @brief PaddingX and PaddingY values, 0 when the attribute isn't set
+        float_t paddingX = 0.f;
+        float_t paddingY = 0.f;
+
+        /// @brief Tooltip text, null when the attribute isn't set
+        const char_t* tooltip = nullptr;
+
+        /// @brief Gets the address of the member from the address of the object
+        void* (*get)(void* obj) = nullptr;
+
+        /// @brief Renders the member, this only depends on the member type
+        bool_t (*render)(void* member, const char_t* name) = nullptr;
+
+        /// @brief Called on the object when the member changes, for the NotifyChange and ModifiedCallback attributes
+        void (*notify)(void* obj) = nullptr;
+        void (*modified)(void* obj) = nullptr;
+
+        /// @brief Whether the member is a nested reflected type, its tree node stays enabled when it is read only, see ChangeContext::readOnly
+        bool_t nested = false;
+
+        /// @brief Renders the member with the templated renderers, when it can't be described by the entry, @c get and @c render are null then
+        bool_t (*fallback)(void* obj) = nullptr;
+    };
+
+    /// @brief Attributes that the member table can describe
+    static constexpr uint32_t TableAttributes = static_cast<uint32_t>(Reflection::AttributeFlags::ReadOnly)
+        | static_cast<uint32_t>(Reflection::AttributeFlags::NotifyChange) | static_cast<uint32_t>(Reflection::AttributeFlags::ModifiedCallback)
+        | static_cast<uint32_t>(Reflection::AttributeFlags::Tooltip) | static_cast<uint32_t>(Reflection::AttributeFlags::CustomName)
+        | static_cast<uint32_t>(Reflection::AttributeFlags::PaddingX) | static_cast<uint32_t>(Reflection::AttributeFlags::PaddingY);
+
+    template <typename ReflectT, typename... DescriptorsT>
+    static constexpr std::array<MemberEntry, sizeof...(DescriptorsT)> CreateMemberTable(refl::util::type_list<DescriptorsT...>);
+
+    template <typename ReflectT, typename DescriptorT>
+    static constexpr MemberEntry CreateMemberEntry();
+
+    /// @brief Renders the members of a reflected type from its member table, used for nested reflected types
+    template <typename ReflectT>
+    static bool_t RenderTableMembers(ReflectT* obj);
+
+    /// @brief Interprets a member table
+    /// @param obj Object
+    /// @param entries Member table
+    /// @param count Number of entries
+    /// @return bool_t, whether any member has been modified
+    static bool_t DisplayMemberTable(void* obj, const MemberEntry* entries, size_t count);
+
+    template <typename MemberT, bool_t Memoized>
+    static bool_t RenderErasedMember(void* member, const char_t* name);
+
+    template <typename ReflectT, typename DescriptorT>
+    static bool_t DisplayMemberFallback(void* obj);
+
+    /// @brief Applies the NotifyChange and ModifiedCallback attributes of a reflected type after one of its members changed
+    template <typename ReflectT>
+    static void NotifyTypeChanged(ReflectT* obj);
+
+    /// @brief Creates the notifier of a reflected type, which applies its attributes when an edit of its members is undone or redone
+    /// @param journaled Whether the edits of the object are recorded
+    /// @return Journal::Notifier, its parent is the current notifier, and its callback is null if the type has no attribute to apply or isn't journaled
+    template <typename ReflectT>
+    static Journal::Notifier CreateTypeNotifier(ReflectT* obj, bool_t journaled);
+
+    /// @brief Creates the notifier of a member, the same way as @c CreateTypeNotifier
+    template <typename ReflectT, typename DescriptorT>
+    static Journal::Notifier CreateMemberNotifier(ReflectT* obj, bool_t journaled);
+
+    /// @brief Renders a top level type, in its own window if needed, the window has a member filter if @p filter is set
+    /// @param id Pointer identifying the object in the ImGui ID stack, usually the object itself
+    template <typename ReflectT>
+    static bool_t RenderTopLevel(ReflectT* obj, const void* id, bool_t inWindow, bool_t filter, bool_t (*renderMembers)(ReflectT*));
+
+    /// @brief Pushes the styles of a member, this only depends on the descriptor so it is shared by all the members and elements it describes
+    /// @return std::pair<int32_t, int32_t>, the number of style colors and style vars to pop
+    template <typename DescriptorT, size_t Depth>
+    _NODISCARD static std::pair<int32_t, int32_t> CheckUpdateStyle();
 };
 
+/// @brief Explicitly instantiates the rendering of a reflected type, and of all the members it renders
+///
+/// This is meant to be used once, in a dedicated source file, with the type declared with TYPE_RENDERER_EXTERN everywhere else
+/// so that the other translation units don't instantiate the renderers again. Nested reflected types are instantiated too,
+/// but they can only be declared extern if they are instantiated on their own. Every entry point is instantiated,
+/// RenderSnapshot with the default channel capacity, other capacities are instantiated where they're used.
+///
+/// For example :
+/// @code
+/// // player_renderer.cpp
+/// TYPE_RENDERER_INSTANTIATE(Player)
+///
+/// // player.hpp
+/// TYPE_RENDERER_EXTERN(Player)
+/// @endcode
+#define TYPE_RENDERER_INSTANTIATE(...)                                                                                                           \
+    template bool_t TypeRenderer::RenderType<__VA_ARGS__>(__VA_ARGS__*, bool_t);                                                                 \
+    template bool_t TypeRenderer::RenderType<__VA_ARGS__>(__VA_ARGS__*, TypeRenderer::ChangeMask<__VA_ARGS__>&, bool_t);                         \
+    template bool_t TypeRenderer::RenderTypes<__VA_ARGS__>(std::span<__VA_ARGS__*>, bool_t);                                                     \
+    template bool_t TypeRenderer::RenderTypeTable<__VA_ARGS__>(__VA_ARGS__*, bool_t);                                                            \
+    template bool_t TypeRenderer::RenderSnapshot<__VA_ARGS__, Snapshot::DefaultCommandCapacity>(Snapshot::Channel<__VA_ARGS__, Snapshot::DefaultCommandCapacity>&, bool_t); \
+    template bool_t TypeRenderer::RenderMembers<__VA_ARGS__>(__VA_ARGS__*);
+
+/// @brief Declares that the rendering of a reflected type is instantiated in another translation unit with TYPE_RENDERER_INSTANTIATE
+#define TYPE_RENDERER_EXTERN(...)                                                                                                                \
+    extern template bool_t TypeRenderer::RenderType<__VA_ARGS__>(__VA_ARGS__*, bool_t);                                                          \
+    extern template bool_t TypeRenderer::RenderType<__VA_ARGS__>(__VA_ARGS__*, TypeRenderer::ChangeMask<__VA_ARGS__>&, bool_t);                  \
+    extern template bool_t TypeRenderer::RenderTypes<__VA_ARGS__>(std::span<__VA_ARGS__*>, bool_t);                                              \
+    extern template bool_t TypeRenderer::RenderTypeTable<__VA_ARGS__>(__VA_ARGS__*, bool_t);                                                     \
+    extern template bool_t TypeRenderer::RenderSnapshot<__VA_ARGS__, Snapshot::DefaultCommandCapacity>(Snapshot::Channel<__VA_ARGS__, Snapshot::DefaultCommandCapacity>&, bool_t); \
+    extern template bool_t TypeRenderer::RenderMembers<__VA_ARGS__>(__VA_ARGS__*);
+
 /// @brief Implementation for a type renderer, template specialization can be used to provide a custom render behavior to a custom type
 /// @tparam MemberT Member type
 /// @tparam Condition Conditional template to use enable if 
 template <typename MemberT, typename Condition = void>
 struct TypeRendererImpl
 {
+    /// @brief Only set by this default implementation, which renders reflected types member by member
+    static constexpr bool_t RendersMembers = true;
+
     /// @brief Renders the provided type
     /// @tparam ReflectT Reflected top level type
     /// @tparam DescriptorT Field descriptor type
@@ -112,6 +690,8 @@ enum class ItDefFlags
     Mutable = 1 << 1,
     // Indicates that the container is a key value pair type
     KeyValuePair = 1 << 2,
+    // Indicates that the elements can't be modified in place, e.g. the elements of a set
+    ConstElements = 1 << 3,
 };
 
 constexpr ItDefFlags operator|(const ItDefFlags left, const ItDefFlags right)
@@ -124,6 +704,33 @@ constexpr size_t operator&(const ItDefFlags left, const ItDefFlags right)
     return static_cast<size_t>(left) & static_cast<size_t>(right);
 }
 
+/// @brief Type of container operation
+enum class ContainerOperationType
+{
+    // Inserts a default constructed element before the index
+    Insert,
+    // Removes the element at the index
+    Remove,
+};
+
+/// @brief Container operation, these are recorded while a container is rendered, and applied all at once afterwards
+struct ContainerOperation
+{
+    /// @brief Operation type
+    ContainerOperationType type;
+
+    /// @brief Element index, relative to the container before any operation is applied
+    size_t index;
+};
+
+/// @brief Describes how to iterate over and mutate a container
+///
+/// Every specialization exposes an @c Iterator type with @c Begin, @c End and @c GetSize, this lets the renderers stream
+/// the elements in order without requiring random access. Random access containers also expose @c GetElement.
+///
+/// Mutable sequence containers implement @c AddElement, @c Insert and @c Remove taking an index, and can implement
+/// @c ApplyOperations to apply a batch of them at once, see ApplyContainerOperations. Key value containers implement
+/// @c AddElement, @c Find, @c Remove and @c ChangeKey
 template <typename>
 struct ContainerDefinition
 {
@@ -139,9 +746,12 @@ struct ContainerDefinition<T[N]>
     using PtrType = T (*)[N];
     using KeyType = decltype(nullptr);
     using ValueType = T;
+    using Iterator = T*;
 
     static constexpr size_t GetSize(const PtrType) { return N; }
     static ValueType& GetElement(PtrType array, const size_t index) { return (*array)[index]; }
+    static Iterator Begin(PtrType array) { return *array; }
+    static Iterator End(PtrType array) { return *array + N; }
 };
 
 template <typename T, size_t N>
@@ -153,69 +763,661 @@ struct ContainerDefinition<std::array<T, N>>
     using PtrType = std::array<T, N>*;
     using KeyType = decltype(nullptr);
     using ValueType = T;
+    using Iterator = typename Type::iterator;
 
     static constexpr size_t GetSize(const PtrType) { return N; }
     static ValueType& GetElement(PtrType array, const size_t index) { return (*array)[index]; }
+    static Iterator Begin(PtrType array) { return array->begin(); }
+    static Iterator End(PtrType array) { return array->end(); }
+};
+
+/// @brief Container definition shared by the resizable random access containers
+/// @tparam ContainerT Container type
+template <typename ContainerT>
+struct DynamicArrayDefinition
+{
+    static constexpr ItDefFlags Flags = ItDefFlags::Exists | ItDefFlags::Mutable;
+
+    using Type = ContainerT;
+    using PtrType = ContainerT*;
+    using KeyType = decltype(nullptr);
+    using ValueType = typename ContainerT::value_type;
+    using Iterator = typename ContainerT::iterator;
+
+    static size_t GetSize(const PtrType array) { return array->size(); }
+    static ValueType& GetElement(PtrType array, const size_t index) { return (*array)[index]; }
+    static Iterator Begin(PtrType array) { return array->begin(); }
+    static Iterator End(PtrType array) { return array->end(); }
+    static void AddElement(PtrType array) { array->emplace_back(); }
+    static void Insert(PtrType array, const size_t index) { array->insert(array->begin() + static_cast<ptrdiff_t>(index), ValueType()); }
+    static void Remove(PtrType array, const size_t index) { array->erase(array->begin() + static_cast<ptrdiff_t>(index)); }
+
+    /// @brief Applies a batch of operations, removals are done in a single compaction pass, and insertions in a single expansion pass
+    /// @param array Container
+    /// @param operations Operations, they will be sorted by index
+    /// @param inserted Receives the inserted elements
+    static void ApplyOperations(PtrType array, std::vector<ContainerOperation>& operations, std::vector<Iterator>& inserted)
+    {
+        inserted.clear();
+        if (operations.empty())
+            return;
+
+        // Operations at the same index keep the order in which they were recorded
+        std::ranges::stable_sort(operations, {}, &ContainerOperation::index);
+
+        // Compaction pass, starting from the first affected element
+        // This also computes where the insertions will happen in the compacted container
+        std::vector<size_t> positions;
+        const size_t size = array->size();
+        size_t write = std::min(operations.front().index, size);
+        auto operation = operations.begin();
+        for (size_t read = write; read < size; read++)
+        {
+            bool_t remove = false;
+            for (; operation != operations.end() && operation->index == read; ++operation)
+            {
+                if (operation->type == ContainerOperationType::Insert)
+                    positions.push_back(write);
+                else
+                    remove = true;
+            }
+
+            if (remove)
+                continue;
+
+            if (write != read)
+                (*array)[write] = std::move((*array)[read]);
+            write++;
+        }
+
+        // Remaining operations are insertions at the end of the container
+        for (; operation != operations.end(); ++operation)
+        {
+            if (operation->type == ContainerOperationType::Insert)
+                positions.push_back(write);
+        }
+
+        array->erase(array->begin() + static_cast<ptrdiff_t>(write), array->end());
+
+        if (positions.empty())
+            return;
+
+        // Expansion pass, from the back so that each element is moved at most once
+        size_t source = array->size();
+        array->resize(source + positions.size());
+        size_t destination = array->size();
+        for (size_t i = positions.size(); i-- > 0;)
+        {
+            while (source > positions[i])
+                (*array)[--destination] = std::move((*array)[--source]);
+
+            (*array)[--destination] = ValueType();
+            positions[i] = destination;
+        }
+
+        // Iterators are only retrieved once the container won't move anymore
+        for (const size_t position : positions)
+            inserted.push_back(array->begin() + static_cast<ptrdiff_t>(position));
+    }
+};
+
+template <typename T>
+struct ContainerDefinition<std::vector<T>> : DynamicArrayDefinition<std::vector<T>>
+{
+};
+
+template <typename T>
+struct ContainerDefinition<std::deque<T>> : DynamicArrayDefinition<std::deque<T>>
+{
 };
 
 template <typename T>
-struct ContainerDefinition<std::vector<T>>
+struct ContainerDefinition<std::list<T>>
 {
     static constexpr ItDefFlags Flags = ItDefFlags::Exists | ItDefFlags::Mutable;
 
-    using Type = std::vector<T>;
-    using PtrType = std::vector<T>*;
+    using Type = std::list<T>;
+    using PtrType = std::list<T>*;
     using KeyType = decltype(nullptr);
     using ValueType = T;
+    using Iterator = typename Type::iterator;
 
     static size_t GetSize(const PtrType array) { return array->size(); }
-    static ValueType& GetElement(PtrType array, const size_t index) { return (*array)[index]; }
+    static Iterator Begin(PtrType array) { return array->begin(); }
+    static Iterator End(PtrType array) { return array->end(); }
     static void AddElement(PtrType array) { array->emplace_back(); }
-    static void Insert(PtrType array, const size_t index) { array->insert(array->begin() + index, ValueType()); }
-    static void Remove(PtrType array, const size_t index) { array->erase(array->begin() + index); }
+    static void Insert(PtrType array, const size_t index) { array->emplace(std::next(array->begin(), static_cast<ptrdiff_t>(index))); }
+    static void Remove(PtrType array, const size_t index) { array->erase(std::next(array->begin(), static_cast<ptrdiff_t>(index))); }
+
+    /// @brief Applies a batch of operations in a single walk of the list
+    /// @param array Container
+    /// @param operations Operations, they will be sorted by index
+    /// @param inserted Receives the inserted elements
+    static void ApplyOperations(PtrType array, std::vector<ContainerOperation>& operations, std::vector<Iterator>& inserted)
+    {
+        inserted.clear();
+
+        // Operations at the same index keep the order in which they were recorded
+        std::ranges::stable_sort(operations, {}, &ContainerOperation::index);
+
+        Iterator it = array->begin();
+        size_t index = 0;
+        for (const ContainerOperation& operation : operations)
+        {
+            // Move to the element the operation refers to
+            for (; index < operation.index && it != array->end(); index++)
+                ++it;
+
+            if (operation.type == ContainerOperationType::Insert)
+            {
+                inserted.push_back(array->emplace(it));
+            }
+            else if (it != array->end())
+            {
+                it = array->erase(it);
+                index++;
+            }
+        }
+    }
 };
 
-template <typename K, typename T>
-struct ContainerDefinition<std::unordered_map<K, T>>
+template <typename T>
+struct ContainerDefinition<std::set<T>>
 {
-    static constexpr ItDefFlags Flags = ItDefFlags::Exists | ItDefFlags::Mutable | ItDefFlags::KeyValuePair;
+    static constexpr ItDefFlags Flags = ItDefFlags::Exists | ItDefFlags::Mutable | ItDefFlags::ConstElements;
 
-    using Type = std::unordered_map<K, T>;
-    using PtrType = std::unordered_map<K, T>*;
-    using KeyType = K;
+    using Type = std::set<T>;
+    using PtrType = std::set<T>*;
+    using KeyType = decltype(nullptr);
     using ValueType = T;
+    using Iterator = typename Type::iterator;
 
-    static void AddElement(PtrType array) { array->insert({KeyType(), ValueType()}); }
-    static void ChangeElement(PtrType array, const KeyType& key, const ValueType& value) { (*array)[key] = value; }
-    static void Remove(PtrType array, const KeyType& key) { array->erase(key); }
+    static size_t GetSize(const PtrType array) { return array->size(); }
+    static Iterator Begin(PtrType array) { return array->begin(); }
+    static Iterator End(PtrType array) { return array->end(); }
+
+    /// @brief Applies a batch of operations in a single walk of the set, insertions add a default constructed element if it doesn't exist
+    /// @param array Container
+    /// @param operations Operations, they will be sorted by index
+    /// @param inserted Receives the inserted elements
+    static void ApplyOperations(PtrType array, std::vector<ContainerOperation>& operations, std::vector<Iterator>& inserted)
+    {
+        inserted.clear();
+
+        std::ranges::stable_sort(operations, {}, &ContainerOperation::index);
+
+        // Removals first, the position of an insertion doesn't matter in a set
+        Iterator it = array->begin();
+        size_t index = 0;
+        size_t insertions = 0;
+        for (const ContainerOperation& operation : operations)
+        {
+            if (operation.type == ContainerOperationType::Insert)
+            {
+                insertions++;
+                continue;
+            }
+
+            for (; index < operation.index && it != array->end(); index++)
+                ++it;
+
+            if (it != array->end())
+            {
+                it = array->erase(it);
+                index++;
+            }
+        }
+
+        for (size_t i = 0; i < insertions; i++)
+        {
+            const auto [element, success] = array->emplace();
+            if (success)
+                inserted.push_back(element);
+        }
+    }
+
+    /// @brief Changes an element without copying the other ones, fails if the new value already exists
+    static bool_t ChangeElement(PtrType array, const Iterator it, const ValueType& value)
+    {
+        if (array->contains(value))
+            return false;
+
+        auto node = array->extract(it);
+        node.value() = value;
+        array->insert(std::move(node));
+        return true;
+    }
 };
 
-#define DEFINE_TYPE_RENDERER_COND(condition)                                                            \
-template <typename MemberT>                                                                             \
-struct TypeRendererImpl<MemberT, Meta::EnableIf<condition>>                                             \
-{                                                                                                       \
-    template <typename ReflectT, typename DescriptorT, size_t Depth>                                    \
-    static bool_t Render(const TypeRenderer::Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata);\
+/// @brief Container definition shared by the map containers
+/// @tparam ContainerT Container type
+template <typename ContainerT>
+struct MapDefinition
+{
+    static constexpr ItDefFlags Flags = ItDefFlags::Exists | ItDefFlags::Mutable | ItDefFlags::KeyValuePair;
+
+    using Type = ContainerT;
+    using PtrType = ContainerT*;
+    using KeyType = typename ContainerT::key_type;
+    using ValueType = typename ContainerT::mapped_type;
+    using Iterator = typename ContainerT::iterator;
+
+    static size_t GetSize(const PtrType array) { return array->size(); }
+    static Iterator Begin(PtrType array) { return array->begin(); }
+    static Iterator End(PtrType array) { return array->end(); }
+    static Iterator Find(PtrType array, const KeyType& key) { return array->find(key); }
+    static void AddElement(PtrType array) { array->insert({KeyType(), ValueType()}); }
+    static void Remove(PtrType array, const Iterator it) { array->erase(it); }
+
+    /// @brief Gets the number of buckets of the map, ordered maps never rehash so this is always 0 for them
+    static size_t GetBucketCount(const PtrType array)
+    {
+        if constexpr (requires { array->bucket_count(); })
+            return array->bucket_count();
+        else
+            return 0;
+    }
+
+    /// @brief Changes the key of an element without copying its value, fails if the new key is already used
+    static bool_t ChangeKey(PtrType array, const Iterator it, const KeyType& newKey)
+    {
+        if (array->contains(newKey))
+            return false;
+
+        auto node = array->extract(it);
+        node.key() = newKey;
+        array->insert(std::move(node));
+        return true;
+    }
 };
 
-#define DEFINE_TYPE_RENDERER_TYPE(type)                                                                 \
-template <>                                                                                             \
-struct TypeRendererImpl<type>                                                                           \
-{                                                                                                       \
-    template <typename ReflectT, typename DescriptorT, size_t Depth>                                    \
-    static bool_t Render(const TypeRenderer::Metadata<ReflectT, type, DescriptorT, Depth>& metadata);   \
+template <typename K, typename T>
+struct ContainerDefinition<std::unordered_map<K, T>> : MapDefinition<std::unordered_map<K, T>>
+{
 };
 
-#define DEFINE_TYPE_RENDERER_TEMP(...)                                                                          \
-struct TypeRendererImpl<__VA_ARGS__>                                                                            \
-{                                                                                                               \
-    template <typename ReflectT, typename DescriptorT, size_t Depth>                                            \
-    static bool_t Render(const TypeRenderer::Metadata<ReflectT, __VA_ARGS__, DescriptorT, Depth>& metadata);    \
+template <typename K, typename T>
+struct ContainerDefinition<std::map<K, T>> : MapDefinition<std::map<K, T>>
+{
 };
 
-DEFINE_TYPE_RENDERER_COND(Meta::IsIntegralNumericOrFloating<MemberT>)
-DEFINE_TYPE_RENDERER_COND(Meta::IsEnum<MemberT>)
-DEFINE_TYPE_RENDERER_COND(ContainerDefinition<MemberT>::Flags & ItDefFlags::Exists && !(ContainerDefinition<MemberT>::Flags & ItDefFlags::KeyValuePair))
+/// @brief Applies a batch of operations to a mutable sequence container
+///
+/// Uses the @c ApplyOperations of the container definition when it has one. Otherwise the operations are applied one by one
+/// with @c Remove, from the last index to the first so that the indices of the remaining removals stay valid, then with
+/// @c Insert and @c AddElement at the final position of each new element
+/// @tparam ContainerT Container type
+/// @param array Container
+/// @param operations Operations, they will be sorted by index
+/// @param inserted Receives the inserted elements
+template <typename ContainerT>
+void ApplyContainerOperations(
+    typename ContainerDefinition<ContainerT>::PtrType array,
+    std::vector<ContainerOperation>& operations,
+    std::vector<typename ContainerDefinition<ContainerT>::Iterator>& inserted
+)
+{
+    using ItDef = ContainerDefinition<ContainerT>;
+
+    if constexpr (requires { ItDef::ApplyOperations(array, operations, inserted); })
+    {
+        ItDef::ApplyOperations(array, operations, inserted);
+    }
+    else
+    {
+        inserted.clear();
+
+        // Operations at the same index keep the order in which they were recorded
+        std::ranges::stable_sort(operations, {}, &ContainerOperation::index);
+
+        // Final position of each inserted element, an insertion goes before the element at its index, even if that element is removed
+        std::vector<size_t> positions;
+        size_t removed = 0;
+        auto removal = operations.begin();
+        for (const ContainerOperation& operation : operations)
+        {
+            if (operation.type != ContainerOperationType::Insert)
+                continue;
+
+            for (; removal != operations.end() && removal->index < operation.index; ++removal)
+                removed += removal->type == ContainerOperationType::Remove;
+
+            positions.push_back(operation.index - removed + positions.size());
+        }
+
+        for (auto operation = operations.rbegin(); operation != operations.rend(); ++operation)
+        {
+            if (operation->type == ContainerOperationType::Remove)
+                ItDef::Remove(array, operation->index);
+        }
+
+        // In increasing order, the elements before each position are already final
+        for (const size_t position : positions)
+        {
+            if (position == ItDef::GetSize(array))
+                ItDef::AddElement(array);
+            else
+                ItDef::Insert(array, position);
+        }
+
+        // Iterators are only retrieved once the container won't change anymore
+        for (const size_t position : positions)
+            inserted.push_back(std::next(ItDef::Begin(array), static_cast<ptrdiff_t>(position)));
+    }
+}
+
+/// @brief Locates a container element through its index for the journal, the address of an element changes when the container grows
+/// @tparam ContainerT Container type
+template <typename ContainerT>
+struct ElementLocator
+{
+    ContainerT* container;
+    size_t index;
+
+    typename ContainerDefinition<ContainerT>::ValueType* operator()() const
+    {
+        using ItDef = ContainerDefinition<ContainerT>;
+        return index < ItDef::GetSize(container) ? &*std::next(ItDef::Begin(container), static_cast<ptrdiff_t>(index)) : nullptr;
+    }
+};
+
+/// @brief Gets the ImGui data type of a numeric type
+/// @tparam T Numeric type
+/// @return ImGuiDataType, the data type
+template <typename T>
+constexpr ImGuiDataType GetDataType()
+{
+    static_assert(Meta::IsIntegralNumericOrFloating<T>, "Only integral numeric types and floating types have an ImGui data type");
+
+    if constexpr (Meta::IsSame<T, int64_t>)
+        return ImGuiDataType_S64;
+    else if constexpr (Meta::IsSame<T, uint64_t>)
+        return ImGuiDataType_U64;
+    else if constexpr (Meta::IsSame<T, int32_t>)
+        return ImGuiDataType_S32;
+    else if constexpr (Meta::IsSame<T, uint32_t>)
+        return ImGuiDataType_U32;
+    else if constexpr (Meta::IsSame<T, int16_t>)
+        return ImGuiDataType_S16;
+    else if constexpr (Meta::IsSame<T, uint16_t>)
+        return ImGuiDataType_U16;
+    else if constexpr (Meta::IsSame<T, int8_t>)
+        return ImGuiDataType_S8;
+    else if constexpr (Meta::IsSame<T, uint8_t>)
+        return ImGuiDataType_U8;
+    else if constexpr (Meta::IsSame<T, float_t>)
+        return ImGuiDataType_Float;
+    else
+        return ImGuiDataType_Double;
+}
+
+/// @brief Minimum number of components of a fused type
+constexpr size_t FusedMinComponents = 2;
+
+/// @brief Maximum number of components of a fused type, this is the biggest multi component widget ImGui has
+constexpr size_t FusedMaxComponents = 4;
+
+/// @brief Checks whether a number of components of type @c T can be rendered with a single multi component widget
+/// @tparam T Component type
+/// @tparam N Number of components
+template <typename T, size_t N>
+constexpr bool_t IsFusable = Meta::IsIntegralNumericOrFloating<T> && N >= FusedMinComponents && N <= FusedMaxComponents;
+
+/// @brief Checks whether a member can be one of the components of a fused struct
+///
+/// Attributes are applied per member, so members that have some aren't fused
+/// 
+/// @tparam DescriptorT Member descriptor
+/// @tparam T Component type
+template <typename DescriptorT, typename T>
+constexpr bool_t IsFusableMember()
+{
+    if constexpr (refl::trait::is_field_v<DescriptorT>)
+        return !DescriptorT::is_static && Meta::IsSame<typename DescriptorT::value_type, T> && std::tuple_size_v<std::remove_cvref_t<decltype(DescriptorT::attributes)>> == 0;
+    else
+        return false;
+}
+
+/// @brief Describes the members of a reflected struct, if they can be fused
+template <typename>
+struct FusedMembers
+{
+    static constexpr bool_t Valid = false;
+};
+
+template <typename First, typename... Others>
+struct FusedMembers<refl::util::type_list<First, Others...>>
+{
+    using ComponentType = Reflection::GetMemberT<First>;
+
+    static constexpr size_t Count = sizeof...(Others) + 1;
+    static constexpr bool_t Valid = IsFusable<ComponentType, Count> && IsFusableMember<First, ComponentType>() && (IsFusableMember<Others, ComponentType>() && ...);
+
+    template <typename T>
+    static void Load(const T* const obj, std::array<ComponentType, Count>& components)
+    {
+        size_t i = 0;
+        components[i++] = obj->*First::pointer;
+        ((components[i++] = obj->*Others::pointer), ...);
+    }
+
+    template <typename T>
+    static void Store(T* const obj, const std::array<ComponentType, Count>& components)
+    {
+        size_t i = 0;
+        obj->*First::pointer = components[i++];
+        ((obj->*Others::pointer = components[i++]), ...);
+    }
+};
+
+/// @brief Describes the members of a type if it's reflected and has the Fused attribute, this avoids reflecting types that aren't
+template <typename T, bool_t = Reflection::IsReflected<T>>
+struct FusedStruct
+{
+    static constexpr bool_t Valid = false;
+};
+
+template <typename T>
+struct FusedStruct<T, true>
+{
+    static constexpr bool_t Valid = false;
+};
+
+template <typename T>
+    requires (Reflection::HasAttribute<Reflection::Fused, TypeDescriptor<T>>())
+struct FusedStruct<T, true> : FusedMembers<Meta::RemoveConstSpecifier<decltype(TypeDescriptor<T>::members)>>
+{
+    // Type attributes such as NotifyChange and ModifiedCallback would be skipped by the single widget
+    static_assert(std::tuple_size_v<std::remove_cvref_t<decltype(TypeDescriptor<T>::attributes)>> == 1, "Fused types can't have other type attributes");
+    static_assert(FusedMembers<Meta::RemoveConstSpecifier<decltype(TypeDescriptor<T>::members)>>::Valid,
+        "Fused types need 2 to 4 non static members of the same numeric type, without attributes");
+};
+
+/// @brief Describes small homogeneous numeric types, which are rendered with a single multi component widget
+///
+/// This applies to C arrays and std::array of 2 to 4 numbers, and to reflected structs with the Fused attribute and 2 to 4 members of
+/// the same numeric type. The components are copied to a contiguous buffer, so the struct members don't need to be contiguous
+template <typename, typename = void>
+struct FusedDefinition
+{
+    /// @brief Number of components, 0 if the type can't be fused
+    static constexpr size_t Count = 0;
+};
+
+template <typename T, size_t N>
+struct FusedDefinition<T[N], Meta::EnableIf<IsFusable<T, N>>>
+{
+    static constexpr size_t Count = N;
+
+    using ComponentType = T;
+
+    static void Load(const T (*obj)[N], std::array<T, N>& components) { std::copy_n(*obj, N, components.begin()); }
+    static void Store(T (*obj)[N], const std::array<T, N>& components) { std::copy_n(components.begin(), N, *obj); }
+};
+
+template <typename T, size_t N>
+struct FusedDefinition<std::array<T, N>, Meta::EnableIf<IsFusable<T, N>>>
+{
+    static constexpr size_t Count = N;
+
+    using ComponentType = T;
+
+    static void Load(const std::array<T, N>* obj, std::array<T, N>& components) { components = *obj; }
+    static void Store(std::array<T, N>* obj, const std::array<T, N>& components) { *obj = components; }
+};
+
+template <typename T>
+struct FusedDefinition<T, Meta::EnableIf<FusedStruct<T>::Valid>>
+{
+    static constexpr size_t Count = FusedStruct<T>::Count;
+
+    using ComponentType = typename FusedStruct<T>::ComponentType;
+
+    static void Load(const T* obj, std::array<ComponentType, Count>& components) { FusedStruct<T>::Load(obj, components); }
+    static void Store(T* obj, const std::array<ComponentType, Count>& components) { FusedStruct<T>::Store(obj, components); }
+};
+
+/// @brief Checks whether the members of a type are rendered individually, and so have their own bit in a change mask
+///
+/// Reflected types with their own TypeRendererImpl specialization are rendered as a whole, like any other value
+/// @tparam T Type
+template <typename T>
+constexpr bool_t IsFlattened = Reflection::IsReflected<T> && FusedDefinition<T>::Count == 0 && requires { TypeRendererImpl<T>::RendersMembers; };
+
+/// @brief Checks whether a type is rendered element by element
+/// @tparam T Type
+template <typename T>
+constexpr bool_t IsContainer = ContainerDefinition<T>::Flags & ItDefFlags::Exists && FusedDefinition<T>::Count == 0;
+
+/// @brief Determines if the value of @c MemberT can be hashed, and so if a read only member of this type can have its draw commands memoized
+///
+/// Nested reflected types have a tree node that needs to stay interactive, so they aren't memoized as a whole
+/// @tparam MemberT 
+template <typename MemberT>
+constexpr bool_t IsMemoizable = (Meta::IsTriviallyCopyable<MemberT> || Meta::IsSame<MemberT, std::string>) && !IsFlattened<MemberT>;
+
+/// @brief Checks whether a type and the types it contains are only rendered by the renderers of this file
+///
+/// Those renderers only use the top level object through attributes, so the member tables can erase it.
+/// Custom TypeRendererImpl specializations can use it, so the members rendering one keep the templated renderers
+/// @tparam T Type
+/// @return bool_t, whether the type is rendered by built-in renderers only
+template <typename T>
+consteval bool_t IsBuiltinRendered()
+{
+    using ItDef = ContainerDefinition<T>;
+
+    if constexpr (Meta::IsIntegralNumericOrFloating<T> || Meta::IsEnum<T> || Meta::IsSame<T, bool_t> || Meta::IsSame<T, std::string>)
+        return true;
+    else if constexpr (FusedDefinition<T>::Count != 0 || IsFlattened<T>)
+        return true;
+    else if constexpr (IsContainer<T> && (ItDef::Flags & ItDefFlags::KeyValuePair))
+        return IsBuiltinRendered<Meta::RemoveConstSpecifier<typename ItDef::KeyType>>() && IsBuiltinRendered<Meta::RemoveConstSpecifier<typename ItDef::ValueType>>();
+    else if constexpr (IsContainer<T>)
+        return IsBuiltinRendered<Meta::RemoveConstSpecifier<typename ItDef::ValueType>>();
+    else if constexpr (requires { typename T::first_type; typename T::second_type; })
+        return Meta::IsSame<T, std::pair<typename T::first_type, typename T::second_type>>
+            && IsBuiltinRendered<typename T::first_type>() && IsBuiltinRendered<typename T::second_type>();
+    else
+        return false;
+}
+
+/// @brief Gets the number of bits a member uses in a change mask, its own bit followed by the bits of its members if it's flattened
+/// @tparam DescriptorT Member descriptor
+/// @return size_t, the number of bits
+template <typename DescriptorT>
+constexpr size_t GetFlatMemberSize()
+{
+    if constexpr (Reflection::IsFunction<DescriptorT>)
+        return 0;
+    else if constexpr (IsFlattened<Reflection::GetMemberT<DescriptorT>>)
+        return 1 + FlatMembers<Reflection::GetMemberT<DescriptorT>>::Count;
+    else
+        return 1;
+}
+
+/// @brief Position of a descriptor in a list of member descriptors
+template <typename DescriptorT, size_t Position>
+struct FlatMemberSlot
+{
+};
+
+/// @brief Derives from the slot of every descriptor of a list, so that the position of a descriptor is found by overload resolution
+template <typename, typename>
+struct FlatMemberSlots;
+
+template <typename... DescriptorsT, size_t... Positions>
+struct FlatMemberSlots<refl::util::type_list<DescriptorsT...>, std::index_sequence<Positions...>> : FlatMemberSlot<DescriptorsT, Positions>...
+{
+};
+
+template <typename DescriptorT, size_t Position>
+constexpr size_t GetFlatMemberPosition(FlatMemberSlot<DescriptorT, Position>) { return Position; }
+
+/// @brief Layout of the change mask of a list of member descriptors
+template <typename>
+struct FlatMemberList;
+
+template <typename... DescriptorsT>
+struct FlatMemberList<refl::util::type_list<DescriptorsT...>>
+{
+    static constexpr size_t Count = (0 + ... + GetFlatMemberSize<DescriptorsT>());
+
+    /// @brief Index of each member in the mask, in declaration order
+    static constexpr std::array<size_t, sizeof...(DescriptorsT)> Indices = []
+    {
+        std::array<size_t, sizeof...(DescriptorsT)> indices{};
+        MAYBE_UNUSED size_t index = 0;
+        MAYBE_UNUSED size_t position = 0;
+        ((indices[position++] = index, index += GetFlatMemberSize<DescriptorsT>()), ...);
+        return indices;
+    }();
+
+    /// @brief Gets the index of a member in the mask, the indices are only computed once for the whole list
+    template <typename DescriptorT>
+    static constexpr size_t IndexOf()
+    {
+        return Indices[GetFlatMemberPosition<DescriptorT>(FlatMemberSlots<refl::util::type_list<DescriptorsT...>, std::index_sequence_for<DescriptorsT...>>{})];
+    }
+};
+
+/// @brief Layout of the change mask of a reflected type
+///
+/// Members are indexed in declaration order, and the members of a nested reflected type directly follow its own index
+/// 
+/// @tparam ReflectT Reflected type
+template <typename ReflectT>
+struct FlatMembers : FlatMemberList<Meta::RemoveConstSpecifier<decltype(TypeDescriptor<ReflectT>::members)>>
+{
+};
+
+#define DEFINE_TYPE_RENDERER_COND(condition)                                                            \
+template <typename MemberT>                                                                             \
+struct TypeRendererImpl<MemberT, Meta::EnableIf<condition>>                                             \
+{                                                                                                       \
+    template <typename ReflectT, typename DescriptorT, size_t Depth>                                    \
+    static bool_t Render(const TypeRenderer::Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata);\
+};
+
+#define DEFINE_TYPE_RENDERER_TYPE(type)                                                                 \
+template <>                                                                                             \
+struct TypeRendererImpl<type>                                                                           \
+{                                                                                                       \
+    template <typename ReflectT, typename DescriptorT, size_t Depth>                                    \
+    static bool_t Render(const TypeRenderer::Metadata<ReflectT, type, DescriptorT, Depth>& metadata);   \
+};
+
+#define DEFINE_TYPE_RENDERER_TEMP(...)                                                                          \
+struct TypeRendererImpl<__VA_ARGS__>                                                                            \
+{                                                                                                               \
+    template <typename ReflectT, typename DescriptorT, size_t Depth>                                            \
+    static bool_t Render(const TypeRenderer::Metadata<ReflectT, __VA_ARGS__, DescriptorT, Depth>& metadata);    \
+};
+
+DEFINE_TYPE_RENDERER_COND(Meta::IsIntegralNumericOrFloating<MemberT>)
+DEFINE_TYPE_RENDERER_COND(Meta::IsEnum<MemberT>)
+DEFINE_TYPE_RENDERER_COND(FusedDefinition<MemberT>::Count != 0)
+DEFINE_TYPE_RENDERER_COND(ContainerDefinition<MemberT>::Flags & ItDefFlags::Exists && !(ContainerDefinition<MemberT>::Flags & ItDefFlags::KeyValuePair) && FusedDefinition<MemberT>::Count == 0)
 DEFINE_TYPE_RENDERER_COND(ContainerDefinition<MemberT>::Flags & ItDefFlags::Exists && ContainerDefinition<MemberT>::Flags & ItDefFlags::KeyValuePair)
 
 DEFINE_TYPE_RENDERER_TYPE(bool_t)
@@ -224,47 +1426,888 @@ DEFINE_TYPE_RENDERER_TYPE(std::string)
 template <typename T0, typename T1>
 DEFINE_TYPE_RENDERER_TEMP(std::pair<T0, T1>)
 
-#pragma endregion
+#pragma endregion
+
+#pragma region Implementation
+
+template <typename ReflectT>
+bool_t TypeRenderer::RenderType(ReflectT* const obj, const bool_t inWindow)
+{
+    ChangeContext& context = GetChangeContext();
+    const bool_t previous = std::exchange(context.journal, Journal::IsEnabled());
+
+    const bool_t changed = RenderTopLevel(obj, obj, inWindow, inWindow, &RenderMembers<ReflectT>);
+
+    context.journal = previous;
+    return changed;
+}
+
+template <typename ReflectT>
+bool_t TypeRenderer::RenderTopLevel(ReflectT* const obj, const void* const id, const bool_t inWindow, const bool_t filter, bool_t (* const renderMembers)(ReflectT*))
+{
+    if (inWindow)
+    {
+        if (!ImGui::Begin(Reflection::GetTypeInfo<ReflectT>().name.c_str()))
+        {
+            ImGui::End();
+            return false;
+        }
+    }
+
+#ifdef TYPE_RENDERER_STATISTICS
+    RenderStatistics::CheckNewFrame();
+
+    const ImDrawList* const drawList = ImGui::GetWindowDrawList();
+    const int32_t vertexCount = drawList->VtxBuffer.Size;
+    const int32_t indexCount = drawList->IdxBuffer.Size;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+#endif
+
+    // The object address is only used as an ID at the top level, nested members and elements use their name
+    // so that their ImGui state doesn't depend on where they're stored in memory
+    ImGui::PushID(id);
+    TYPE_RENDERER_STAT_ADD(ids, 1);
+
+    ChangeContext& context = GetChangeContext();
+    const ChangeContext previous = context;
+    if (filter)
+        DisplayMemberFilter<ReflectT>();
+
+    const bool_t changed = renderMembers(obj);
+
+    context.visible = previous.visible;
+    context.offset = previous.offset;
+    ImGui::PopID();
+
+#ifdef TYPE_RENDERER_STATISTICS
+    RenderStatistics::AddTypeTiming(Reflection::GetTypeInfo<ReflectT>().name.c_str(),
+        std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+    RenderStatistics::Frame& frame = RenderStatistics::GetCurrentFrame();
+    frame.vertices += static_cast<uint32_t>(drawList->VtxBuffer.Size - vertexCount);
+    frame.indices += static_cast<uint32_t>(drawList->IdxBuffer.Size - indexCount);
+#endif
+
+    if (inWindow)
+        ImGui::End();
+    return changed;
+}
+
+template <typename ReflectT>
+bool_t TypeRenderer::RenderType(ReflectT* const obj, ChangeMask<ReflectT>& changes, const bool_t inWindow)
+{
+    changes.reset();
+
+    ChangeContext& context = GetChangeContext();
+    const ChangeContext previous = context;
+    context = {
+        .mask = &changes,
+        .set = [](void* const mask, const size_t index) { static_cast<ChangeMask<ReflectT>*>(mask)->set(index); },
+        .offset = 0,
+    };
+
+    const bool_t changed = RenderType(obj, inWindow);
+
+    context = previous;
+    return changed;
+}
+
+template <typename ReflectT>
+bool_t TypeRenderer::RenderTypes(const std::span<ReflectT*> objs, const bool_t inWindow)
+{
+    if (objs.empty())
+        return false;
+
+    ChangeMask<ReflectT> changes;
+
+    ChangeContext& context = GetChangeContext();
+    const ChangeContext previous = context;
+    context = {
+        .mask = &changes,
+        .set = [](void* const mask, const size_t index) { static_cast<ChangeMask<ReflectT>*>(mask)->set(index); },
+        .offset = 0,
+        .objects = objs.data(),
+        .getObject = [](const void* const objects, const size_t index) -> const void* { return static_cast<ReflectT* const*>(objects)[index]; },
+        .objectCount = objs.size(),
+        .journal = Journal::IsEnabled(),
+    };
+
+    const size_t recordCount = Journal::GetRecordCount();
+    const bool_t changed = RenderTopLevel(objs.front(), objs.front(), inWindow, inWindow, &RenderMembers<ReflectT>);
+
+    context = previous;
+
+    // The displayed object was edited, the modified members are copied to the other objects in one pass
+    // The previous values of the copies are recorded in the step of the edit, unless the edit was merged with the last step, e.g. while dragging,
+    // which already holds the values from before the first edit
+    if (changed)
+    {
+        const bool_t journal = Journal::IsEnabled() && Journal::GetRecordCount() != recordCount;
+        for (ReflectT* const obj : objs.subspan(1))
+            CopyChangedMembers(*objs.front(), *obj, changes, 0, journal);
+    }
+
+    return changed;
+}
+
+template <typename ReflectT, size_t Capacity>
+bool_t TypeRenderer::RenderSnapshot(Snapshot::Channel<ReflectT, Capacity>& channel, const bool_t inWindow)
+{
+    ReflectT* const obj = channel.Acquire();
+    if (!obj)
+        return false;
+
+    ChangeMask<ReflectT> changes;
+
+    ChangeContext& context = GetChangeContext();
+    const ChangeContext previous = context;
+    context = {
+        .mask = &changes,
+        .set = [](void* const mask, const size_t index) { static_cast<ChangeMask<ReflectT>*>(mask)->set(index); },
+        .offset = 0,
+        .snapshot = true,
+    };
+
+    // The snapshot moves between the buffers of the channel, so the channel is used as an ID to keep the widget states
+    const bool_t changed = RenderTopLevel(obj, &channel, inWindow, inWindow, &RenderMembers<ReflectT>);
+
+    context = previous;
+
+    if (changed)
+        SendChangedMembers(Meta::RemoveConstSpecifier<decltype(TypeDescriptor<ReflectT>::members)>{}, refl::util::type_list<>{}, *obj, changes, 0, channel);
+
+    return changed;
+}
+
+template <typename TopT, size_t Capacity, typename ReflectT, typename... PathT, typename... DescriptorsT>
+void TypeRenderer::SendChangedMembers(refl::util::type_list<DescriptorsT...>, refl::util::type_list<PathT...>, const ReflectT& snapshot,
+    const ChangeMask<TopT>& changes, const size_t offset, Snapshot::Channel<TopT, Capacity>& channel)
+{
+    (SendChangedMember<TopT, Capacity, DescriptorsT>(refl::util::type_list<PathT...>{}, snapshot, changes, offset, channel), ...);
+}
+
+template <typename TopT, size_t Capacity, typename DescriptorT, typename ReflectT, typename... PathT>
+void TypeRenderer::SendChangedMember(refl::util::type_list<PathT...>, MAYBE_UNUSED const ReflectT& snapshot, MAYBE_UNUSED const ChangeMask<TopT>& changes,
+    MAYBE_UNUSED const size_t offset, MAYBE_UNUSED Snapshot::Channel<TopT, Capacity>& channel)
+{
+    if constexpr (Reflection::IsFunction<DescriptorT>)
+    {
+        return;
+    }
+    else if constexpr (DescriptorT::is_static || !DescriptorT::is_writable)
+    {
+        return;
+    }
+    else
+    {
+        using MemberT = Reflection::GetMemberT<DescriptorT>;
+
+        const size_t index = offset + FlatMembers<ReflectT>::template IndexOf<DescriptorT>();
+        if (!changes.test(index))
+            return;
+
+        const MemberT& member = DescriptorT::get(snapshot);
+
+        // The other members of a nested reflected type may have been changed by the owner since the snapshot was taken
+        if constexpr (IsFlattened<MemberT>)
+        {
+            SendChangedMembers(Meta::RemoveConstSpecifier<decltype(TypeDescriptor<MemberT>::members)>{}, refl::util::type_list<PathT..., DescriptorT>{},
+                member, changes, index + 1, channel);
+        }
+        else if constexpr (Meta::IsCopyAssignable<MemberT>)
+        {
+            // The edit is lost if the queue is full, the next snapshot then shows the value of the owner
+            channel.Send(std::make_unique<MemberCommand<TopT, PathT..., DescriptorT>>(index, member));
+        }
+    }
+}
+
+template <typename ReflectT, typename... DescriptorsT>
+class TypeRenderer::MemberCommand final : public Snapshot::Command<ReflectT>
+{
+public:
+    using MemberT = Reflection::GetMemberT<std::tuple_element_t<sizeof...(DescriptorsT) - 1, std::tuple<DescriptorsT...>>>;
+
+    MemberCommand(const size_t member, const MemberT& value) : m_Member(member), m_Value(value) {}
+
+    void Apply(ReflectT& obj) override { Assign<DescriptorsT...>(obj); }
+
+    size_t GetMember() const override { return m_Member; }
+
+private:
+    template <typename DescriptorT, typename... RestT, typename ObjectT>
+    void Assign(ObjectT& obj)
+    {
+        auto& member = const_cast<Reflection::GetMemberT<DescriptorT>&>(DescriptorT::get(obj));
+        if constexpr (sizeof...(RestT) == 0)
+            member = std::move(m_Value);
+        else
+            Assign<RestT...>(member);
+
+        // The notifications go from the member up to the top level type, as for an edit made in place
+        NotifyMemberChanged<ObjectT, DescriptorT>(obj);
+        NotifyTypeChanged(&obj);
+    }
+
+    size_t m_Member;
+    MemberT m_Value;
+};
+
+template <typename MemberT>
+bool_t TypeRenderer::IsMixedValue(const MemberT* const member)
+{
+    const ChangeContext& context = GetChangeContext();
+    if (!context.objects)
+        return false;
+
+    const ptrdiff_t offset = reinterpret_cast<const char_t*>(member) - static_cast<const char_t*>(context.getObject(context.objects, 0));
+
+    // The same member of each object is compared to the displayed one, one object at a time
+    // These values are in different objects, one per cache line at best, so there is nothing contiguous to compare in batches,
+    // and the loop stops at the first difference, which is usually found in the first objects
+    for (size_t i = 1; i < context.objectCount; i++)
+    {
+        const MemberT* const other = reinterpret_cast<const MemberT*>(static_cast<const char_t*>(context.getObject(context.objects, i)) + offset);
+
+        // Values without padding compare their bytes, which doesn't need to go through the equality operator and is a fixed size comparison
+        // Floating point values too, in which case NaN values are equal, and 0 and -0 aren't
+        if constexpr (Meta::HasUniqueObjectRepresentations<MemberT> || Meta::IsFloatingPoint<MemberT>)
+        {
+            if (std::memcmp(member, other, sizeof(MemberT)) != 0)
+                return true;
+        }
+        else if constexpr (Meta::IsEqualityComparable<MemberT>)
+        {
+            if (!(*member == *other))
+                return true;
+        }
+        else
+        {
+            return IsContainer<MemberT>;
+        }
+    }
+
+    return false;
+}
+
+template <typename ReflectT, size_t Count>
+bool_t TypeRenderer::CopyChangedMembers(const ReflectT& source, ReflectT& target, const std::bitset<Count>& changes, const size_t offset, const bool_t journal)
+{
+    const Journal::Notifier notifier = CreateTypeNotifier(&target, journal);
+    if (notifier.notify)
+        Journal::SetNotifier(&notifier);
+
+    const bool_t changed = CopyChangedMembers(Meta::RemoveConstSpecifier<decltype(TypeDescriptor<ReflectT>::members)>{}, source, target, changes, offset, journal);
+
+    Journal::SetNotifier(notifier.parent);
+
+    if (changed)
+        NotifyTypeChanged(&target);
+
+    return changed;
+}
+
+template <typename ReflectT, typename... DescriptorsT, size_t Count>
+bool_t TypeRenderer::CopyChangedMembers(refl::util::type_list<DescriptorsT...>, const ReflectT& source, ReflectT& target, const std::bitset<Count>& changes,
+    const size_t offset, const bool_t journal)
+{
+    // Every member needs to be copied, so the results are combined without short circuiting
+    return (false | ... | CopyChangedMember<ReflectT, DescriptorsT>(source, target, changes, offset, journal));
+}
+
+template <typename ReflectT, typename DescriptorT, size_t Count>
+bool_t TypeRenderer::CopyChangedMember(MAYBE_UNUSED const ReflectT& source, MAYBE_UNUSED ReflectT& target, MAYBE_UNUSED const std::bitset<Count>& changes,
+    MAYBE_UNUSED const size_t offset, MAYBE_UNUSED const bool_t journal)
+{
+    if constexpr (Reflection::IsFunction<DescriptorT>)
+    {
+        return false;
+    }
+    // Static members are shared by all the objects, and members that can't be written can't be edited either
+    else if constexpr (DescriptorT::is_static || !DescriptorT::is_writable)
+    {
+        return false;
+    }
+    else
+    {
+        using MemberT = Reflection::GetMemberT<DescriptorT>;
+
+        const size_t index = offset + FlatMembers<ReflectT>::template IndexOf<DescriptorT>();
+        if (!changes.test(index))
+            return false;
+
+        const MemberT& sourceMember = DescriptorT::get(source);
+        MemberT& targetMember = const_cast<MemberT&>(DescriptorT::get(target));
+
+        const Journal::Notifier notifier = CreateMemberNotifier<ReflectT, DescriptorT>(&target, journal);
+        if (notifier.notify)
+            Journal::SetNotifier(&notifier);
+
+        // Only the modified members of nested reflected types are copied, the other ones may differ between the objects
+        // Containers are copied as a whole, they can only be edited when they are the same in all the objects
+        if constexpr (IsFlattened<MemberT>)
+        {
+            CopyChangedMembers(sourceMember, targetMember, changes, index + 1, journal);
+        }
+        else if constexpr (Meta::IsCopyAssignable<MemberT>)
+        {
+            // The previous value is undone together with the edit of the displayed object
+            if constexpr (Meta::IsCopyConstructible<MemberT>)
+            {
+                if (journal)
+                    Journal::Record(std::make_unique<Journal::ValueDelta<MemberT, Journal::PointerLocator<MemberT>>>(Journal::PointerLocator<MemberT>{ &targetMember }, MemberT(targetMember)), 0, true);
+            }
+
+            targetMember = sourceMember;
+        }
+
+        Journal::SetNotifier(notifier.parent);
+
+        NotifyMemberChanged<ReflectT, DescriptorT>(target);
+        return true;
+    }
+}
+
+template <typename ReflectT, typename DescriptorT>
+void TypeRenderer::NotifyMemberChanged(MAYBE_UNUSED ReflectT& obj)
+{
+    using NotifyChangeT = Reflection::NotifyChange<ReflectT>;
+    using ModifiedCallbackT = Reflection::ModifiedCallback<ReflectT>;
+
+    if constexpr (Reflection::HasAttribute<NotifyChangeT, DescriptorT>())
+    {
+        constexpr NotifyChangeT notify = Reflection::GetAttribute<NotifyChangeT, DescriptorT>();
+        obj.*notify.pointer = true;
+    }
+
+    if constexpr (Reflection::HasAttribute<ModifiedCallbackT, DescriptorT>())
+    {
+        constexpr ModifiedCallbackT notify = Reflection::GetAttribute<ModifiedCallbackT, DescriptorT>();
+        TYPE_RENDERER_STAT_CALLBACK_SCOPE();
+        notify.callback(&obj);
+    }
+}
+
+template <typename ReflectT>
+bool_t TypeRenderer::RenderMembers(ReflectT* const obj)
+{
+    // Both passes need to run, static members would otherwise disappear for a frame when a member changes
+    const Journal::Notifier notifier = CreateTypeNotifier(obj, GetChangeContext().journal && !GetChangeContext().snapshot);
+    if (notifier.notify)
+        Journal::SetNotifier(&notifier);
+
+    bool_t changed = DisplayMembers<ReflectT, false>(obj);
+    changed |= DisplayMembers<ReflectT, true>(obj);
+
+    Journal::SetNotifier(notifier.parent);
+    
+    // Snapshots are notified by the commands applying their edits, on the thread that owns them
+    if (changed && !GetChangeContext().snapshot)
+        NotifyTypeChanged(obj);
+
+    return changed;
+}
+
+template <typename ReflectT>
+void TypeRenderer::NotifyTypeChanged(MAYBE_UNUSED ReflectT* const obj)
+{
+    using NotifyChangeT = Reflection::NotifyChange<ReflectT>;
+    using ModifiedCallbackT = Reflection::ModifiedCallback<ReflectT>;
+    using DescriptorT = decltype(Reflection::GetTypeInfo<ReflectT>());
+
+    if constexpr (Reflection::HasAttribute<NotifyChangeT, DescriptorT>())
+    {
+        // Value was changed, set the pointer to true
+        constexpr NotifyChangeT notify = Reflection::GetAttribute<NotifyChangeT, DescriptorT>();
+        obj->*notify.pointer = true;
+    }
+
+    if constexpr (Reflection::HasAttribute<ModifiedCallbackT, DescriptorT>())
+    {
+        constexpr ModifiedCallbackT notify = Reflection::GetAttribute<ModifiedCallbackT, DescriptorT>();
+        TYPE_RENDERER_STAT_CALLBACK_SCOPE();
+        notify.callback(obj);
+    }
+}
+
+template <typename ReflectT>
+Journal::Notifier TypeRenderer::CreateTypeNotifier(MAYBE_UNUSED ReflectT* const obj, MAYBE_UNUSED const bool_t journaled)
+{
+    using DescriptorT = decltype(Reflection::GetTypeInfo<ReflectT>());
+
+    Journal::Notifier notifier = { .parent = Journal::GetNotifier() };
+    if constexpr (Reflection::HasAttribute<Reflection::NotifyChange<ReflectT>, DescriptorT>() || Reflection::HasAttribute<Reflection::ModifiedCallback<ReflectT>, DescriptorT>())
+    {
+        if (journaled)
+        {
+            notifier.notify = [](void* const object) { NotifyTypeChanged(static_cast<ReflectT*>(object)); };
+            notifier.obj = obj;
+        }
+    }
+
+    return notifier;
+}
+
+template <typename ReflectT, typename DescriptorT>
+Journal::Notifier TypeRenderer::CreateMemberNotifier(MAYBE_UNUSED ReflectT* const obj, MAYBE_UNUSED const bool_t journaled)
+{
+    Journal::Notifier notifier = { .parent = Journal::GetNotifier() };
+    if constexpr (Reflection::HasAttribute<Reflection::NotifyChange<ReflectT>, DescriptorT>() || Reflection::HasAttribute<Reflection::ModifiedCallback<ReflectT>, DescriptorT>())
+    {
+        if (journaled)
+        {
+            notifier.notify = [](void* const object) { NotifyMemberChanged<ReflectT, DescriptorT>(*static_cast<ReflectT*>(object)); };
+            notifier.obj = obj;
+        }
+    }
+
+    return notifier;
+}
+
+template <typename ReflectT>
+bool_t TypeRenderer::RenderTypeTable(ReflectT* const obj, const bool_t inWindow)
+{
+    // Members rendered by the templated renderers would otherwise report their changes to an enclosing change mask
+    ChangeContext& context = GetChangeContext();
+    const ChangeContext previous = context;
+    context.mask = nullptr;
+    context.journal = Journal::IsEnabled();
+
+    const bool_t changed = RenderTopLevel(obj, obj, inWindow, false, &RenderTableMembers<ReflectT>);
+
+    context = previous;
+    return changed;
+}
+
+template <typename ReflectT>
+bool_t TypeRenderer::RenderTableMembers(ReflectT* const obj)
+{
+    static constexpr auto table = CreateMemberTable<ReflectT>(Meta::RemoveConstSpecifier<decltype(TypeDescriptor<ReflectT>::members)>{});
+
+    const Journal::Notifier notifier = CreateTypeNotifier(obj, GetChangeContext().journal && !GetChangeContext().snapshot);
+    if (notifier.notify)
+        Journal::SetNotifier(&notifier);
+
+    const bool_t changed = DisplayMemberTable(obj, table.data(), table.size());
+
+    Journal::SetNotifier(notifier.parent);
+
+    if (changed)
+        NotifyTypeChanged(obj);
+
+    return changed;
+}
+
+template <typename ReflectT, typename... DescriptorsT>
+constexpr std::array<TypeRenderer::MemberEntry, sizeof...(DescriptorsT)> TypeRenderer::CreateMemberTable(refl::util::type_list<DescriptorsT...>)
+{
+    return { CreateMemberEntry<ReflectT, DescriptorsT>()... };
+}
+
+template <typename ReflectT, typename DescriptorT>
+constexpr TypeRenderer::MemberEntry TypeRenderer::CreateMemberEntry()
+{
+    using MemberT = Reflection::GetMemberT<DescriptorT>;
+    using NotifyChangeT = Reflection::NotifyChange<ReflectT>;
+    using ModifiedCallbackT = Reflection::ModifiedCallback<ReflectT>;
+
+    MemberEntry entry;
+    entry.name = GetMemberName<DescriptorT>();
+
+    if constexpr (Reflection::IsFunction<DescriptorT>)
+    {
+        entry.fallback = &DisplayMemberFallback<ReflectT, DescriptorT>;
+        return entry;
+    }
+    else
+    {
+        // Every attribute needs to have a flag the table handles, attributes without a flag such as Range can't be described
+        // Custom renderers get the actual top level object from the templated renderers
+        constexpr uint32_t flags = static_cast<uint32_t>(Reflection::AttributeMask<DescriptorT>);
+        constexpr size_t attributeCount = std::tuple_size_v<Meta::RemoveConstSpecifier<decltype(DescriptorT::attributes)>>;
+        constexpr bool_t described = (flags & ~TableAttributes) == 0 && static_cast<size_t>(std::popcount(flags)) == attributeCount
+            && IsBuiltinRendered<Meta::RemoveConstSpecifier<MemberT>>();
+
+        entry.isStatic = DescriptorT::is_static;
+
+        if constexpr (!described)
+        {
+            entry.fallback = &DisplayMemberFallback<ReflectT, DescriptorT>;
+        }
+        else
+        {
+            entry.readOnly = !DescriptorT::is_writable || Reflection::HasAttribute<Reflection::ReadOnly, DescriptorT>();
+
+            if constexpr (Reflection::HasAttribute<Reflection::PaddingX, DescriptorT>())
+                entry.paddingX = Reflection::GetAttribute<Reflection::PaddingX, DescriptorT>().value;
+
+            if constexpr (Reflection::HasAttribute<Reflection::PaddingY, DescriptorT>())
+                entry.paddingY = Reflection::GetAttribute<Reflection::PaddingY, DescriptorT>().value;
+
+            if constexpr (Reflection::HasAttribute<Reflection::Tooltip, DescriptorT>())
+                entry.tooltip = Reflection::GetAttribute<Reflection::Tooltip, DescriptorT>().text;
+
+            entry.nested = IsFlattened<MemberT>;
+            entry.get = [](void* const obj) -> void* { return GetMemberPointer<ReflectT, MemberT, DescriptorT, 0>(static_cast<ReflectT*>(obj)); };
+
+            // Read only members can't change from the UI, so they only need to be laid out again when their value changes
+            if constexpr (IsMemoizable<MemberT>)
+                entry.render = entry.readOnly ? &RenderErasedMember<MemberT, true> : &RenderErasedMember<MemberT, false>;
+            else
+                entry.render = &RenderErasedMember<MemberT, false>;
+
+            if constexpr (Reflection::HasAttribute<NotifyChangeT, DescriptorT>())
+            {
+                entry.notify = [](void* const obj)
+                {
+                    constexpr NotifyChangeT notify = Reflection::GetAttribute<NotifyChangeT, DescriptorT>();
+                    static_cast<ReflectT*>(obj)->*notify.pointer = true;
+                };
+            }
+
+            if constexpr (Reflection::HasAttribute<ModifiedCallbackT, DescriptorT>())
+            {
+                entry.modified = [](void* const obj)
+                {
+                    constexpr ModifiedCallbackT notify = Reflection::GetAttribute<ModifiedCallbackT, DescriptorT>();
+                    TYPE_RENDERER_STAT_CALLBACK_SCOPE();
+                    notify.callback(static_cast<ReflectT*>(obj));
+                };
+            }
+        }
+
+        return entry;
+    }
+}
+
+inline bool_t TypeRenderer::DisplayMemberTable(void* const obj, const MemberEntry* const entries, const size_t count)
+{
+    bool_t anyChanged = false;
+    bool_t hasStatic = false;
+
+    // Same culling as the templated path, the heights are indexed by entry
+    const bool_t cull = count >= MemberCullingMinCount;
+    std::vector<float_t>* heights = nullptr;
+    float_t clipMin = 0.f;
+    float_t clipMax = 0.f;
+    float_t skipped = 0.f;
+    if (cull)
+    {
+        heights = &GetWidgetState<std::vector<float_t>>(ImGui::GetID("##memberHeights"));
+        heights->resize(count, -1.f);
+
+        const ImRect& clipRect = ImGui::GetCurrentWindow()->ClipRect;
+        clipMin = clipRect.Min.y;
+        clipMax = clipRect.Max.y;
+    }
+
+    const float_t itemSpacing = ImGui::GetStyle().ItemSpacing.y;
+
+    // Static members are displayed after the other ones
+    for (const bool_t staticPass : { false, true })
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const MemberEntry& entry = entries[i];
+            if (entry.isStatic != staticPass)
+                continue;
+
+            TYPE_RENDERER_STAT_ADD(members, 1);
+            hasStatic |= staticPass;
+
+            float_t start = 0.f;
+            if (cull)
+            {
+                float_t& height = (*heights)[i];
+                if (height < 0.f)
+                    height = ImGui::GetFrameHeightWithSpacing();
+
+                const float_t top = ImGui::GetCursorScreenPos().y + skipped;
+                if (top + height < clipMin || top > clipMax)
+                {
+                    skipped += height;
+                    continue;
+                }
+
+                if (skipped > 0.f)
+                {
+                    ImGui::Dummy(ImVec2(0.f, std::max(skipped - itemSpacing, 0.f)));
+                    skipped = 0.f;
+                }
+
+                start = ImGui::GetCursorPosY();
+            }
+
+            if (entry.fallback)
+            {
+                anyChanged |= entry.fallback(obj);
+            }
+            else
+            {
+                if (entry.paddingY != 0.f)
+                    ImGui::Dummy(ImVec2(0.f, entry.paddingY));
+
+                if (entry.paddingX != 0.f)
+                {
+                    ImGui::Dummy(ImVec2(entry.paddingX, 0.f));
+                    ImGui::SameLine();
+                }
+
+                // The tree node of a nested reflected type stays enabled so it can be opened, its members are disabled instead
+                ChangeContext& context = GetChangeContext();
+                const bool_t readOnly = context.readOnly;
+                const bool_t disabled = readOnly || entry.readOnly;
+                if (entry.nested)
+                    context.readOnly = disabled;
+
+                ImGui::BeginDisabled(disabled && !entry.nested);
+                const bool_t changed = entry.render(entry.get(obj), entry.name);
+                ImGui::EndDisabled();
+
+                context.readOnly = readOnly;
+
+                if (changed)
+                {
+                    if (entry.notify)
+                        entry.notify(obj);
+
+                    if (entry.modified)
+                        entry.modified(obj);
+                }
+
+                if (entry.tooltip)
+                    ImGui::SetItemTooltip("%s", entry.tooltip);
+
+                anyChanged |= changed;
+            }
+
+            if (cull)
+                (*heights)[i] = ImGui::GetCursorPosY() - start;
+        }
+    }
+
+    if (skipped > 0.f)
+        ImGui::Dummy(ImVec2(0.f, std::max(skipped - itemSpacing, 0.f)));
+
+    if (hasStatic)
+        ImGui::Separator();
+
+    return anyChanged;
+}
+
+template <typename MemberT, bool_t Memoized>
+bool_t TypeRenderer::RenderErasedMember(void* const member, const char_t* const name)
+{
+    if constexpr (IsFlattened<MemberT>)
+    {
+        // Nested reflected types are rendered from their own table
+        ImGui::PushID(name);
+        TYPE_RENDERER_STAT_ADD(ids, 1);
+
+        bool_t changed = false;
+        if (ImGui::TreeNodeEx(name))
+        {
+            changed = RenderTableMembers(static_cast<MemberT*>(member));
+            ImGui::TreePop();
+        }
+
+        ImGui::PopID();
+        return changed;
+    }
+    else
+    {
+        // Only built-in renderers get here, see IsBuiltinRendered, and they only use the top level object through attributes
+        const Metadata<ErasedObject, MemberT, Reflection::PlainDescriptor<MemberT>, 0> metadata = {
+            .topLevelObj = nullptr,
+            .name = name,
+            .obj = static_cast<MemberT*>(member),
+        };
+
+        if constexpr (Memoized)
+        {
+            DisplayMemoizedMember(metadata);
+            return false;
+        }
+        else
+        {
+            return DisplaySimpleMember(metadata);
+        }
+    }
+}
+
+template <typename ReflectT, typename DescriptorT>
+bool_t TypeRenderer::DisplayMemberFallback(void* const obj)
+{
+    using MemberT = Reflection::GetMemberT<DescriptorT>;
+
+    ReflectT* const reflected = static_cast<ReflectT*>(obj);
+    const Metadata<ReflectT, MemberT, DescriptorT, 0> metadata = CreateMetadata<ReflectT, MemberT, DescriptorT, 0>(reflected);
+
+    bool_t changed = false;
+    if constexpr (Reflection::IsFunction<DescriptorT>)
+    {
+        DisplayFunction<ReflectT, MemberT, DescriptorT, 0>(metadata);
+    }
+    else
+    {
+        // The static pass of the table already told the static members apart
+        MAYBE_UNUSED bool_t hasStatic = false;
+        changed = DisplayField<ReflectT, MemberT, DescriptorT, 0, DescriptorT::is_static>(metadata, hasStatic);
+    }
+
+    CheckDisplayTooltip(metadata);
+    return changed;
+}
+
+inline TypeRenderer::ChangeContext& TypeRenderer::GetChangeContext()
+{
+    static ChangeContext context;
+    return context;
+}
+
+inline const char_t* TypeRenderer::FormatIndex(char_t (&buffer)[LabelBufferSize], const size_t index)
+{
+    const std::to_chars_result result = std::to_chars(buffer, buffer + LabelBufferSize - 1, index);
+    *result.ptr = '\0';
+    return buffer;
+}
+
+inline std::pair<size_t, size_t> TypeRenderer::DisplayPageNavigation(const size_t size, size_t pageSize, const int32_t jumpIndex)
+{
+    pageSize = std::max<size_t>(pageSize, 1);
+    const int32_t pageCount = static_cast<int32_t>(std::max<size_t>((size + pageSize - 1) / pageSize, 1));
+
+    int32_t* const page = ImGui::GetStateStorage()->GetIntRef(ImGui::GetID("##page"), 0);
+    if (jumpIndex != -1)
+        *page = jumpIndex / static_cast<int32_t>(pageSize);
+    *page = std::clamp(*page, 0, pageCount - 1);
+
+    ImGui::BeginDisabled(*page == 0);
+    if (ImGui::ArrowButton("##previousPage", ImGuiDir_Left))
+        (*page)--;
+    ImGui::EndDisabled();
+
+    ImGui::SameLine();
+    ImGui::Text("Page %d / %d (%zu elements)", *page + 1, pageCount, size);
+    ImGui::SameLine();
+
+    ImGui::BeginDisabled(*page == pageCount - 1);
+    if (ImGui::ArrowButton("##nextPage", ImGuiDir_Right))
+        (*page)++;
+    ImGui::EndDisabled();
+
+    const size_t first = static_cast<size_t>(*page) * pageSize;
+    return { first, std::min(first + pageSize, size) };
+}
+
+template <typename T>
+void TypeRenderer::DisplaySummary(const T* const data, const size_t size, const size_t binCount)
+{
+    struct SummaryCache
+    {
+        bool_t valid = false;
+        size_t size = 0;
+        uint64_t hash = 0;
+        NumericSummary::Summary summary;
+    };
+
+    const ImGuiID id = ImGui::GetID("##summary");
+    if (!ImGui::TreeNode("Summary"))
+    {
+        // Nothing is hashed while the summary is closed
+        ReleaseWidgetState<SummaryCache>(id);
+        return;
+    }
+
+    // Hashing is a lot cheaper than computing the summary, which needs several passes over the elements
+    SummaryCache& cache = GetWidgetState<SummaryCache>(id);
+    const uint64_t hash = NumericSummary::Hash(data, size);
+    if (!cache.valid || cache.size != size || cache.hash != hash)
+    {
+        cache.summary = NumericSummary::Compute(data, size, binCount);
+        cache.valid = true;
+        cache.size = size;
+        cache.hash = hash;
+    }
+
+    const NumericSummary::Summary& summary = cache.summary;
+    ImGui::Text("Count: %zu, NaN/Inf: %zu", summary.count, summary.nonFinite);
+    ImGui::Text("Min: %g, Max: %g", summary.minimum, summary.maximum);
+    ImGui::Text("Mean: %g, Std dev: %g", summary.mean, summary.deviation);
+    ImGui::PlotHistogram("##histogram", summary.histogram.data(), static_cast<int32_t>(summary.histogram.size()), 0, nullptr, 0.f, std::numeric_limits<float_t>::max(), ImVec2(0.f, 80.f));
 
-#pragma region Implementation
+    ImGui::TreePop();
+}
 
-template <typename ReflectT>
-bool_t TypeRenderer::RenderType(ReflectT* const obj, const bool_t inWindow)
+template <typename StateT>
+StateT& TypeRenderer::GetWidgetState(const ImGuiID id)
 {
-    if (inWindow)
+    WidgetStates<StateT>& states = GetWidgetStates<StateT>();
+    const int32_t frame = ImGui::GetFrameCount();
+
+    // Unused states are collected every WidgetStateLifetime frames, instead of checking every state each frame
+    // The states used in the current frame are kept, so the references returned earlier stay valid
+    if (frame - states.collectionFrame >= WidgetStateLifetime)
     {
-        if (!ImGui::Begin(Reflection::GetTypeInfo<ReflectT>().name.c_str()))
-        {
-            ImGui::End();
-            return false;
-        }
+        states.collectionFrame = frame;
+        std::erase_if(states.entries, [frame](const auto& entry) -> bool_t { return frame - entry.second.frame >= WidgetStateLifetime; });
     }
 
-    const bool_t changed = DisplayMembers<ReflectT, false>(obj) || DisplayMembers<ReflectT, true>(obj);
-    
-    if (changed)
-    {
-        using NotifyChangeT = Reflection::NotifyChange<ReflectT>;
-        using ModifiedCallbackT = Reflection::ModifiedCallback<ReflectT>;
-        using DescriptorT = decltype(Reflection::GetTypeInfo<ReflectT>());
+    typename WidgetStates<StateT>::Entry& entry = states.entries[id];
+    entry.frame = frame;
+    return entry.state;
+}
 
-        if constexpr (Reflection::HasAttribute<NotifyChangeT, DescriptorT>())
-        {
-            // Value was changed, set the pointer to true
-            constexpr NotifyChangeT notify = Reflection::GetAttribute<NotifyChangeT, DescriptorT>();
-            obj->*notify.pointer = true;
-        }
+template <typename StateT>
+void TypeRenderer::ReleaseWidgetState(const ImGuiID id)
+{
+    GetWidgetStates<StateT>().entries.erase(id);
+}
 
-        if constexpr (Reflection::HasAttribute<ModifiedCallbackT, DescriptorT>())
-        {
-            constexpr ModifiedCallbackT notify = Reflection::GetAttribute<ModifiedCallbackT, DescriptorT>();
-            notify.callback(obj);
-        }
-    }
+template <typename StateT>
+TypeRenderer::WidgetStates<StateT>& TypeRenderer::GetWidgetStates()
+{
+    static WidgetStates<StateT> states;
+    return states;
+}
 
-    if (inWindow)
-        ImGui::End();
-    return changed;
+inline bool_t TypeRenderer::IsJournaled()
+{
+    return GetChangeContext().journal;
+}
+
+inline TypeRenderer::ElementsState& TypeRenderer::CheckEvictElementsState(const size_t size)
+{
+    ElementsState& state = GetElementsState();
+
+    // Rows are indexed in order, so the rows past the end are removed in a single range, along with everything nested in them
+    // The widget states of GetWidgetState nested in them are released once they are no longer used
+    state.rows.erase(state.rows.lower_bound(size), state.rows.end());
+    return state;
+}
+
+inline TypeRenderer::ElementsState& TypeRenderer::GetElementsState()
+{
+    ElementsState& state = GetWidgetState<ElementsState>(ImGui::GetID("##elements"));
+    state.parent = ImGui::GetStateStorage();
+    return state;
+}
+
+inline void TypeRenderer::PushElementState(ElementsState& state, const size_t row)
+{
+    const auto it = state.rows.find(row);
+    state.row = row;
+    state.isEmpty = it == state.rows.end();
+    ImGui::SetStateStorage(state.isEmpty ? &state.empty : &it->second);
+}
+
+inline void TypeRenderer::PopElementState(ElementsState& state)
+{
+    ImGui::SetStateStorage(state.parent);
+
+    // The row stored something for the first time, it gets its own storage and the empty one is reused by the next rows
+    if (state.isEmpty && !state.empty.Data.empty())
+        state.rows[state.row].Data.swap(state.empty.Data);
 }
 
 template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
@@ -288,6 +2331,140 @@ constexpr const char_t* TypeRenderer::GetMemberName()
     return DescriptorT::name.c_str();
 }
 
+template <typename ReflectT>
+constexpr size_t TypeRenderer::GetMemberPathsSize()
+{
+    std::string text;
+    std::vector<size_t> offsets;
+    std::vector<size_t> parents;
+    AppendMemberPaths(Meta::RemoveConstSpecifier<decltype(TypeDescriptor<ReflectT>::members)>{}, text, offsets, parents, {}, NoParent);
+
+    return text.size();
+}
+
+template <typename ReflectT>
+constexpr auto TypeRenderer::CreateMemberPaths()
+{
+    // The paths are built in a transient string, and then copied to the table that is kept
+    std::string text;
+    std::vector<size_t> offsets;
+    std::vector<size_t> parents;
+    AppendMemberPaths(Meta::RemoveConstSpecifier<decltype(TypeDescriptor<ReflectT>::members)>{}, text, offsets, parents, {}, NoParent);
+
+    MemberPathTable<FlatMembers<ReflectT>::Count, GetMemberPathsSize<ReflectT>()> table;
+    std::copy(text.begin(), text.end(), table.text.begin());
+    std::copy(offsets.begin(), offsets.end(), table.offsets.begin());
+    std::copy(parents.begin(), parents.end(), table.parents.begin());
+
+    return table;
+}
+
+template <typename... DescriptorsT>
+constexpr void TypeRenderer::AppendMemberPaths(refl::util::type_list<DescriptorsT...>, std::string& text, std::vector<size_t>& offsets, std::vector<size_t>& parents,
+    const std::string_view prefix, const size_t parent)
+{
+    (AppendMemberPath<DescriptorsT>(text, offsets, parents, prefix, parent), ...);
+}
+
+template <typename DescriptorT>
+constexpr void TypeRenderer::AppendMemberPath(std::string& text, std::vector<size_t>& offsets, std::vector<size_t>& parents, const std::string_view prefix, const size_t parent)
+{
+    using MemberT = Reflection::GetMemberT<DescriptorT>;
+
+    // Functions don't have an index in the change mask
+    if constexpr (!Reflection::IsFunction<DescriptorT>)
+    {
+        std::string path(prefix);
+        if (!path.empty())
+            path += '.';
+
+        for (const char_t* c = GetMemberName<DescriptorT>(); *c != '\0'; c++)
+            path += ToLower(*c);
+
+        const size_t index = offsets.size();
+        offsets.push_back(text.size());
+        parents.push_back(parent);
+        text += path;
+        text += '\0';
+
+        // Members of a nested reflected type directly follow it, as in the change mask
+        if constexpr (IsFlattened<MemberT>)
+            AppendMemberPaths(Meta::RemoveConstSpecifier<decltype(TypeDescriptor<MemberT>::members)>{}, text, offsets, parents, path, index);
+    }
+}
+
+constexpr char_t TypeRenderer::ToLower(const char_t c)
+{
+    return c >= 'A' && c <= 'Z' ? static_cast<char_t>(c - 'A' + 'a') : c;
+}
+
+template <typename ReflectT>
+void TypeRenderer::DisplayMemberFilter()
+{
+    MemberFilter& filter = GetWidgetState<MemberFilter>(ImGui::GetID("##filter"));
+
+    ImGui::SetNextItemWidth(-FLT_MIN);
+    if (ImGui::InputTextWithHint("##filter", "Filter", &filter.query) || filter.visible.size() != FlatMembers<ReflectT>::Count)
+        UpdateMemberFilter<ReflectT>(filter);
+
+    if (filter.query.empty())
+        return;
+
+    if (filter.matches == 0)
+        ImGui::TextDisabled("No member matches the filter");
+
+    ChangeContext& context = GetChangeContext();
+    context.visible = filter.visible.data();
+    context.offset = 0;
+}
+
+template <typename ReflectT>
+void TypeRenderer::UpdateMemberFilter(MemberFilter& filter)
+{
+    static constexpr auto paths = CreateMemberPaths<ReflectT>();
+
+    filter.visible.assign(paths.offsets.size(), 0);
+    filter.matches = 0;
+
+    std::string query = filter.query;
+    std::transform(query.begin(), query.end(), query.begin(), ToLower);
+
+    for (size_t i = 0; i < paths.offsets.size(); i++)
+    {
+        const std::string_view path(paths.text.data() + paths.offsets[i]);
+        if (!path.contains(query))
+            continue;
+
+        filter.matches++;
+
+        // Parents are displayed too, so that the match can be reached, they come before their members so they may already be visible
+        for (size_t member = i; member != NoParent && !filter.visible[member]; member = paths.parents[member])
+            filter.visible[member] = 1;
+    }
+}
+
+template <typename ReflectT, typename DescriptorT>
+bool_t TypeRenderer::IsFilteredOut()
+{
+    const ChangeContext& context = GetChangeContext();
+
+    // Functions and static members of a snapshot would run on the UI thread, while the owner thread uses them
+    if constexpr (Reflection::IsFunction<DescriptorT> || DescriptorT::is_static)
+    {
+        if (context.snapshot)
+            return true;
+    }
+
+    if (!context.visible)
+        return false;
+
+    // Functions don't have a path, so they're hidden while filtering
+    if constexpr (Reflection::IsFunction<DescriptorT>)
+        return true;
+    else
+        return !context.visible[context.offset + FlatMembers<ReflectT>::template IndexOf<DescriptorT>()];
+}
+
 template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
 MemberT* TypeRenderer::GetMemberPointer(MAYBE_UNUSED ReflectT* const obj)
 {
@@ -304,15 +2481,77 @@ bool_t TypeRenderer::DisplayMembers(ReflectT* const obj)
 {
     // Get reflected data
     constexpr TypeDescriptor<ReflectT> desc = Reflection::GetTypeInfo<ReflectT>();
+    constexpr size_t memberCount = Meta::RemoveConstSpecifier<decltype(desc.members)>::size;
+    constexpr bool_t cull = memberCount >= MemberCullingMinCount;
 
     bool_t hasStatic = false;
     bool_t anyChanged = false;
 
+    // Wide types only submit the members that intersect the clip rectangle, the others are replaced by their last measured height
+    // Both passes share the same heights, the members are indexed in declaration order
+    MAYBE_UNUSED std::vector<float_t>* heights = nullptr;
+    MAYBE_UNUSED float_t clipMin = 0.f;
+    MAYBE_UNUSED float_t clipMax = 0.f;
+    MAYBE_UNUSED float_t skipped = 0.f;
+    MAYBE_UNUSED size_t memberIndex = 0;
+    if constexpr (cull)
+    {
+        heights = &GetWidgetState<std::vector<float_t>>(ImGui::GetID("##memberHeights"));
+        heights->resize(memberCount, -1.f);
+
+        const ImRect& clipRect = ImGui::GetCurrentWindow()->ClipRect;
+        clipMin = clipRect.Min.y;
+        clipMax = clipRect.Max.y;
+    }
+
     // Loop over each reflected member
     refl::util::for_each(desc.members, [&]<typename DescriptorT>(const DescriptorT)
     {
         using MemberT = Reflection::GetMemberT<DescriptorT>;
 
+        TYPE_RENDERER_STAT_ADD(members, 1);
+
+        // Filtered out members aren't displayed at all, so they don't take any height either
+        if (IsFilteredOut<ReflectT, DescriptorT>())
+        {
+            if constexpr (cull)
+                memberIndex++;
+            return;
+        }
+
+        // Functions are only displayed with the member fields
+        constexpr bool_t displayed = Reflection::IsFunction<DescriptorT> ? !IsStatic : IsStatic == DescriptorT::is_static;
+
+        MAYBE_UNUSED float_t* height = nullptr;
+        MAYBE_UNUSED float_t start = 0.f;
+        if constexpr (cull && displayed)
+        {
+            height = &(*heights)[memberIndex];
+            if (*height < 0.f)
+                *height = EstimateMemberHeight<MemberT, DescriptorT>();
+
+            // Skipped members haven't been laid out yet, so they're added to the cursor position
+            const float_t top = ImGui::GetCursorScreenPos().y + skipped;
+            if (top + *height < clipMin || top > clipMax)
+            {
+                if constexpr (IsStatic)
+                    hasStatic = true;
+
+                skipped += *height;
+                memberIndex++;
+                return;
+            }
+
+            if (skipped > 0.f)
+            {
+                // The dummy item is followed by the item spacing, which is already part of the heights
+                ImGui::Dummy(ImVec2(0.f, std::max(skipped - ImGui::GetStyle().ItemSpacing.y, 0.f)));
+                skipped = 0.f;
+            }
+
+            start = ImGui::GetCursorPosY();
+        }
+
         const Metadata<ReflectT, MemberT, DescriptorT, 0> metadata = CreateMetadata<ReflectT, MemberT, DescriptorT, 0>(obj);
 
         if constexpr (Reflection::IsFunction<DescriptorT>)
@@ -326,8 +2565,24 @@ bool_t TypeRenderer::DisplayMembers(ReflectT* const obj)
         }
 
         CheckDisplayTooltip(metadata);
+
+        if constexpr (cull)
+        {
+            // Measure the member, this also picks up collapsing headers being opened or closed
+            if constexpr (displayed)
+                *height = ImGui::GetCursorPosY() - start;
+
+            memberIndex++;
+        }
     });
 
+    if constexpr (cull)
+    {
+        // Keep the content size of the window for the members that were skipped at the end
+        if (skipped > 0.f)
+            ImGui::Dummy(ImVec2(0.f, std::max(skipped - ImGui::GetStyle().ItemSpacing.y, 0.f)));
+    }
+
     if constexpr (IsStatic)
     {
         if (hasStatic)
@@ -339,6 +2594,16 @@ bool_t TypeRenderer::DisplayMembers(ReflectT* const obj)
     return anyChanged;
 }
 
+template <typename MemberT, typename DescriptorT>
+float_t TypeRenderer::EstimateMemberHeight()
+{
+    // Expanded nested types show their header and their members, every other member starts as a single row, e.g. a collapsed header
+    if constexpr (IsFlattened<MemberT> && Reflection::HasAttribute<Reflection::Expanded, DescriptorT>())
+        return ImGui::GetFrameHeightWithSpacing() * static_cast<float_t>(FlatMembers<MemberT>::Count + 1);
+    else
+        return ImGui::GetFrameHeightWithSpacing();
+}
+
 template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth, bool_t IsStatic>
 bool_t TypeRenderer::DisplayField(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata, bool_t& hasStatic)
 {
@@ -348,6 +2613,7 @@ bool_t TypeRenderer::DisplayField(const Metadata<ReflectT, MemberT, DescriptorT,
 
     constexpr bool_t isConst = !DescriptorT::is_writable;
     constexpr bool_t readOnly = Reflection::HasAttribute<Reflection::ReadOnly, DescriptorT>();
+    static_assert(isConst || readOnly || !Reflection::HasAttribute<Reflection::RefreshRate, DescriptorT>(), "The RefreshRate attribute can only be used on read only fields");
 
     // We want to display static fields when IsStatic is true, and member fields when IsStatic is false
     // Hence the binary operations
@@ -367,22 +2633,142 @@ bool_t TypeRenderer::DisplayField(const Metadata<ReflectT, MemberT, DescriptorT,
     bool_t changed = false;
     if constexpr (display)
     {
-        ImGui::BeginDisabled(isConst || readOnly);
-        changed = DisplaySimpleMember<ReflectT, MemberT, DescriptorT>(metadata);
+        // Members of a nested reflected type report their changes after the index of the field
+        // Other types can render reflected types too, e.g. container elements, those changes are only reported by the field itself
+        ChangeContext& context = GetChangeContext();
+        const ChangeContext previous = context;
+        const size_t index = context.offset + FlatMembers<ReflectT>::template IndexOf<DescriptorT>();
+
+        // The members of nested reflected types are compared on their own
+        MAYBE_UNUSED bool_t mixed = false;
+        MAYBE_UNUSED ImVec2 mixedStart;
+        if constexpr (!IsFlattened<MemberT> && !DescriptorT::is_static)
+        {
+            // Comparing containers goes through all their elements, so this is only done while their header is open and they can be edited
+            // The header is submitted by DisplaySimpleMember under the ID of the member, and keeps its state in the state storage
+            // Containers with a custom renderer may not have a header, they are always compared
+            bool_t compare = true;
+            if constexpr (IsContainer<MemberT> && IsBuiltinRendered<MemberT>())
+            {
+                if (context.objects)
+                {
+                    ImGui::PushID(metadata.name);
+                    compare = ImGui::GetStateStorage()->GetInt(ImGui::GetID(metadata.name)) != 0;
+                    ImGui::PopID();
+                }
+            }
 
-        if (changed)
+            mixed = compare && IsMixedValue(metadata.obj);
+            if (mixed)
+            {
+                mixedStart = ImGui::GetCursorScreenPos();
+                ImGui::PushItemFlag(ImGuiItemFlags_MixedValue, true);
+            }
+        }
+
+        if constexpr (IsFlattened<MemberT>)
         {
-            if constexpr (Reflection::HasAttribute<NotifyChangeT, DescriptorT>())
+            context.offset = index + 1;
+        }
+        else
+        {
+            context.mask = nullptr;
+            context.visible = nullptr;
+            context.objects = nullptr;
+
+            // Containers record their own operations
+            context.journal = previous.journal && IsContainer<MemberT>;
+        }
+
+        // Other trivially copyable members are recorded as raw bytes, their value is copied before it can change
+        // The members of flattened types are recorded one by one
+        constexpr bool_t journalBytes = !(isConst || readOnly) && Meta::IsTriviallyCopyable<MemberT> && !IsContainer<MemberT> && !IsFlattened<MemberT>;
+        MAYBE_UNUSED std::array<std::byte, journalBytes ? sizeof(MemberT) : 0> before;
+        if constexpr (journalBytes)
+        {
+            if (previous.journal)
+                std::memcpy(before.data(), metadata.obj, sizeof(MemberT));
+        }
+
+        // Other values are recorded as a whole, strings when their widget is activated and other values on the frames a widget can be
+        constexpr bool_t journalValue = !(isConst || readOnly) && !journalBytes && !IsContainer<MemberT> && !IsFlattened<MemberT>;
+        MAYBE_UNUSED std::optional<Journal::ValueEdit<MemberT>> edit;
+        if constexpr (journalValue)
+            edit.emplace(previous.journal, *metadata.obj);
+
+        // Undoing and redoing the edits recorded in the member notify it as an edit made in place would
+        const Journal::Notifier notifier = CreateMemberNotifier<ReflectT, DescriptorT>(metadata.topLevelObj, !(isConst || readOnly) && previous.journal && !previous.snapshot);
+        if (notifier.notify)
+            Journal::SetNotifier(&notifier);
+
+        // Containers are copied as a whole to the other objects, so they can only be edited while they are the same in all of them
+        MAYBE_UNUSED bool_t locked = false;
+        if constexpr (IsContainer<MemberT> && !DescriptorT::is_static)
+            locked = mixed;
+
+        // The tree node of a nested reflected type stays enabled so it can be opened, its members are disabled instead
+        const bool_t disabled = previous.readOnly || isConst || readOnly || locked;
+        if constexpr (IsFlattened<MemberT>)
+            context.readOnly = disabled;
+
+        ImGui::BeginDisabled(disabled && !IsFlattened<MemberT>);
+
+        // Read only members can't change from the UI, so they only need to be laid out again when their value changes
+        if constexpr ((isConst || readOnly) && Reflection::HasAttribute<Reflection::RefreshRate, DescriptorT>())
+            DisplaySampledMember<ReflectT, MemberT, DescriptorT, Depth>(metadata.topLevelObj, metadata.name, [&metadata]() -> MemberT { return *metadata.obj; });
+        else if constexpr ((isConst || readOnly) && IsMemoizable<MemberT>)
+            DisplayMemoizedMember<ReflectT, MemberT, DescriptorT>(metadata);
+        else
+            changed = DisplaySimpleMember<ReflectT, MemberT, DescriptorT>(metadata);
+
+        context = previous;
+
+        if constexpr (journalBytes)
+        {
+            if (changed && previous.journal)
+                Journal::RecordBytes(metadata.obj, before.data(), sizeof(MemberT), ImGui::GetItemID());
+        }
+        else if constexpr (journalValue)
+        {
+            edit->End(*metadata.obj, changed, [&metadata] { return Journal::PointerLocator<MemberT>{ metadata.obj }; });
+        }
+
+        Journal::SetNotifier(notifier.parent);
+
+        if constexpr (!IsFlattened<MemberT> && !DescriptorT::is_static)
+        {
+            if (mixed)
             {
-                // Value was changed, set the pointer to true
-                constexpr NotifyChangeT notify = Reflection::GetAttribute<NotifyChangeT, DescriptorT>();
-                metadata.topLevelObj->*notify.pointer = true;
+                // Checkboxes and radio buttons display the mixed value flag themselves, every member also gets a mark on its left
+                ImGui::PopItemFlag();
+
+                const float_t spacing = ImGui::GetStyle().ItemSpacing.x;
+                ImGui::GetWindowDrawList()->AddRectFilled(ImVec2(mixedStart.x - spacing * .75f, mixedStart.y),
+                    ImVec2(mixedStart.x - spacing * .25f, ImGui::GetItemRectMax().y), ImGui::GetColorU32(ImGuiCol_CheckMark));
             }
+        }
 
-            if constexpr (Reflection::HasAttribute<ModifiedCallbackT, DescriptorT>())
+        if (changed)
+        {
+            if (context.mask)
+                context.set(context.mask, index);
+
+            // Snapshots are notified by the commands applying their edits, on the thread that owns them
+            if (!context.snapshot)
             {
-                constexpr ModifiedCallbackT notify = Reflection::GetAttribute<ModifiedCallbackT, DescriptorT>();
-                notify.callback(metadata.topLevelObj);
+                if constexpr (Reflection::HasAttribute<NotifyChangeT, DescriptorT>())
+                {
+                    // Value was changed, set the pointer to true
+                    constexpr NotifyChangeT notify = Reflection::GetAttribute<NotifyChangeT, DescriptorT>();
+                    metadata.topLevelObj->*notify.pointer = true;
+                }
+
+                if constexpr (Reflection::HasAttribute<ModifiedCallbackT, DescriptorT>())
+                {
+                    constexpr ModifiedCallbackT notify = Reflection::GetAttribute<ModifiedCallbackT, DescriptorT>();
+                    TYPE_RENDERER_STAT_CALLBACK_SCOPE();
+                    notify.callback(metadata.topLevelObj);
+                }
             }
         }
 
@@ -392,17 +2778,221 @@ bool_t TypeRenderer::DisplayField(const Metadata<ReflectT, MemberT, DescriptorT,
     return changed;
 }
 
+template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
+void TypeRenderer::DisplayMemoizedMember(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata)
+{
+    DisplayMemoizedMember<ReflectT, MemberT, DescriptorT>(metadata, HashMember(*metadata.obj));
+}
+
+template <typename MemberT>
+uint64_t TypeRenderer::HashMember(const MemberT& member)
+{
+    if constexpr (Meta::IsSame<MemberT, std::string>)
+        return NumericSummary::Hash(member.data(), member.size());
+    else
+        return NumericSummary::Hash(&member, 1);
+}
+
+template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
+void TypeRenderer::DisplayMemoizedMember(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata, const uint64_t valueHash)
+{
+    using DynamicRange = Reflection::DynamicRange<ReflectT, MemberT>;
+    using DynamicTooltip = Reflection::DynamicTooltip<ReflectT>;
+
+    ImDrawList* const drawList = ImGui::GetWindowDrawList();
+    DrawMemo& memo = GetWidgetState<DrawMemo>(ImGui::GetID(metadata.name));
+
+    // Attributes reading other members change the widget without changing the value
+    uint64_t hash = valueHash;
+    if constexpr (Reflection::HasAttribute<DynamicRange, DescriptorT>())
+    {
+        constexpr DynamicRange range = Reflection::GetAttribute<DynamicRange, DescriptorT>();
+        std::array<MemberT, 2> bounds = { MemberT{}, metadata.topLevelObj->*range.maximum };
+        if constexpr (range.minimum != nullptr)
+            bounds[0] = metadata.topLevelObj->*range.minimum;
+
+        hash ^= NumericSummary::Hash(bounds.data(), bounds.size()) + (hash << 6) + (hash >> 2);
+    }
+
+    if constexpr (Reflection::HasAttribute<DynamicTooltip, DescriptorT>())
+    {
+        constexpr DynamicTooltip tooltip = Reflection::GetAttribute<DynamicTooltip, DescriptorT>();
+        hash ^= HashMember(metadata.topLevelObj->*tooltip.text) + (hash << 6) + (hash >> 2);
+    }
+
+    // Everything the layout of the member depends on
+    const float_t availableWidth = ImGui::GetContentRegionAvail().x;
+    const float_t fontSize = ImGui::GetFontSize();
+    const ImU32 textColor = ImGui::GetColorU32(ImGuiCol_Text);
+    const ImDrawCmdHeader& header = drawList->_CmdHeader;
+
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const ImRect rect(origin, ImVec2(origin.x + memo.size.x, origin.y + memo.size.y));
+
+    // The recorded geometry isn't clipped, so it can only be replayed where it's fully visible, and in a draw command like the one it was recorded in
+    if (memo.valid && memo.hash == hash && memo.availableWidth == availableWidth && memo.fontSize == fontSize && memo.textColor == textColor
+        && memo.textureId == header.TextureId && std::memcmp(&memo.clipRect, &header.ClipRect, sizeof(ImVec4)) == 0
+        && ImGui::GetCurrentWindow()->ClipRect.Contains(rect))
+    {
+        const int32_t vertexCount = static_cast<int32_t>(memo.vertices.size());
+        const int32_t indexCount = static_cast<int32_t>(memo.indices.size());
+
+        drawList->PrimReserve(indexCount, vertexCount);
+
+        // Read after reserving, reserving can start a new vertex offset
+        const ImDrawIdx vertexBase = static_cast<ImDrawIdx>(drawList->_VtxCurrentIdx);
+        for (const ImDrawVert& vertex : memo.vertices)
+            *drawList->_VtxWritePtr++ = { ImVec2(vertex.pos.x + origin.x, vertex.pos.y + origin.y), vertex.uv, vertex.col };
+
+        for (const ImDrawIdx index : memo.indices)
+            *drawList->_IdxWritePtr++ = static_cast<ImDrawIdx>(vertexBase + index);
+
+        drawList->_VtxCurrentIdx += static_cast<uint32_t>(vertexCount);
+
+        // Takes the same space as the member, so that the layout and tooltips stay the same
+        ImGui::Dummy(memo.size);
+        return;
+    }
+
+    const int32_t commandCount = drawList->CmdBuffer.Size;
+    const int32_t firstVertex = drawList->VtxBuffer.Size;
+    const int32_t firstIndex = drawList->IdxBuffer.Size;
+    const uint32_t firstVertexIndex = drawList->_VtxCurrentIdx;
+
+    ImGui::BeginGroup();
+    DisplaySimpleMember<ReflectT, MemberT, DescriptorT>(metadata);
+    ImGui::EndGroup();
+
+    memo.valid = false;
+    memo.size = ImGui::GetItemRectSize();
+
+    // Only record members that were drawn in the current draw command, and that are fully visible
+    // A new command means that the member changed the texture or clip rect, which replaying doesn't support
+    if (drawList->CmdBuffer.Size != commandCount || !ImGui::GetCurrentWindow()->ClipRect.Contains(ImRect(ImGui::GetItemRectMin(), ImGui::GetItemRectMax())))
+        return;
+
+    // Positions are stored relative to the cursor, so they can be replayed anywhere
+    memo.vertices.assign(drawList->VtxBuffer.begin() + firstVertex, drawList->VtxBuffer.end());
+    for (ImDrawVert& vertex : memo.vertices)
+        vertex.pos = ImVec2(vertex.pos.x - origin.x, vertex.pos.y - origin.y);
+
+    memo.indices.assign(drawList->IdxBuffer.begin() + firstIndex, drawList->IdxBuffer.end());
+    for (ImDrawIdx& index : memo.indices)
+        index = static_cast<ImDrawIdx>(index - firstVertexIndex);
+
+    memo.valid = true;
+    memo.hash = hash;
+    memo.availableWidth = availableWidth;
+    memo.fontSize = fontSize;
+    memo.textColor = textColor;
+    memo.textureId = header.TextureId;
+    memo.clipRect = header.ClipRect;
+}
+
+template <typename ReflectT, typename ValueT, typename DescriptorT, size_t Depth, typename SampleT>
+void TypeRenderer::DisplaySampledMember(ReflectT* const topLevelObj, const char_t* const name, const SampleT& sample)
+{
+    static_assert(Meta::IsDefaultConstructible<ValueT> && Meta::IsCopyAssignable<ValueT>, "Sampled members need to be default constructible and copy assignable");
+
+    // Last sampled value, the widget always displays this copy
+    struct Sample
+    {
+        ValueT value;
+        double_t time = 0.0;
+        uint64_t hash = 0;
+        bool_t valid = false;
+    };
+
+    Sample& cached = GetWidgetState<Sample>(ImGui::GetID(name));
+
+    const double_t time = ImGui::GetTime();
+    bool_t refresh = true;
+    if constexpr (Reflection::HasAttribute<Reflection::RefreshRate, DescriptorT>())
+    {
+        constexpr Reflection::RefreshRate refreshRate = Reflection::GetAttribute<Reflection::RefreshRate, DescriptorT>();
+        refresh = !cached.valid || time - cached.time >= 1.0 / static_cast<double_t>(refreshRate.rate);
+    }
+
+    if (refresh)
+    {
+        cached.value = sample();
+        cached.time = time;
+        cached.valid = true;
+
+        if constexpr (IsMemoizable<ValueT>)
+            cached.hash = HashMember(cached.value);
+    }
+
+    const Metadata<ReflectT, ValueT, DescriptorT, Depth> metadata = {
+        .topLevelObj = topLevelObj,
+        .name = name,
+        .obj = &cached.value,
+    };
+
+    // The copy is only formatted again when a new sample changes it
+    if constexpr (IsMemoizable<ValueT>)
+        DisplayMemoizedMember<ReflectT, ValueT, DescriptorT>(metadata, cached.hash);
+    else
+        DisplaySimpleMember<ReflectT, ValueT, DescriptorT>(metadata);
+}
+
 template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
 void TypeRenderer::DisplayFunction(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata)
 {
-    ImGui::PushID(metadata.obj);
-    const std::pair<int32_t, int32_t> styleInfo = CheckUpdateStyle(metadata);
+    ImGui::PushID(metadata.name);
+    TYPE_RENDERER_STAT_ADD(ids, 1);
+    const std::pair<int32_t, int32_t> styleInfo = CheckUpdateStyle<DescriptorT, Depth>();
+
+    if constexpr (Reflection::IsProperty<DescriptorT>)
+    {
+        // Properties are getters, their value is displayed like a read only field
+        using ValueT = Meta::RemoveConstSpecifier<Meta::RemoveReferenceSpecifier<decltype(DescriptorT::invoke(*metadata.topLevelObj))>>;
+
+        // A nested reflected value keeps its tree node enabled, see ChangeContext::readOnly
+        ChangeContext& context = GetChangeContext();
+        const bool_t readOnly = std::exchange(context.readOnly, true);
+
+        ImGui::BeginDisabled(!IsFlattened<ValueT>);
+        if constexpr (Reflection::HasAttribute<Reflection::RefreshRate, DescriptorT>())
+        {
+            DisplaySampledMember<ReflectT, ValueT, DescriptorT, Depth>(metadata.topLevelObj, metadata.name, [&metadata]() -> ValueT
+            {
+                return DescriptorT::invoke(*metadata.topLevelObj);
+            });
+        }
+        else
+        {
+            // Without a refresh rate the getter is called every frame, its result is displayed directly instead of through a stored copy
+            decltype(auto) value = DescriptorT::invoke(*metadata.topLevelObj);
+            const Metadata<ReflectT, ValueT, DescriptorT, Depth> valueMetadata = {
+                .topLevelObj = metadata.topLevelObj,
+                .name = metadata.name,
+                .obj = const_cast<ValueT*>(&value),
+            };
+
+            if constexpr (IsMemoizable<ValueT>)
+                DisplayMemoizedMember<ReflectT, ValueT, DescriptorT>(valueMetadata);
+            else
+                DisplaySimpleMember<ReflectT, ValueT, DescriptorT>(valueMetadata);
+        }
+        ImGui::EndDisabled();
 
-    if (ImGui::Button(metadata.name))
+        context.readOnly = readOnly;
+    }
+    else
     {
-        (metadata.topLevelObj->**metadata.obj)();
+        // Functions of a read only nested type could modify it
+        ImGui::BeginDisabled(GetChangeContext().readOnly);
+        if (ImGui::Button(metadata.name))
+        {
+            TYPE_RENDERER_STAT_CALLBACK_SCOPE();
+            (metadata.topLevelObj->**metadata.obj)();
+        }
+        ImGui::EndDisabled();
     }
 
+    TYPE_RENDERER_STAT_ADD(values, 1);
+
     ImGui::PopStyleColor(styleInfo.first);
     ImGui::PopStyleVar(styleInfo.second);
     ImGui::PopID();
@@ -430,8 +3020,8 @@ void TypeRenderer::CheckDisplayTooltip(const Metadata<ReflectT, MemberT, Descrip
     }
 }
 
-template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
-std::pair<int32_t, int32_t> TypeRenderer::CheckUpdateStyle(const Metadata<ReflectT, MemberT, DescriptorT, Depth>&)
+template <typename DescriptorT, size_t Depth>
+std::pair<int32_t, int32_t> TypeRenderer::CheckUpdateStyle()
 {
     // This is needed because we need to pop things afterwards
     std::pair<int32_t, int32_t> styleInfo;
@@ -449,46 +3039,51 @@ std::pair<int32_t, int32_t> TypeRenderer::CheckUpdateStyle(const Metadata<Reflec
         ImGui::SameLine();
     }
 
-    // Apply color styles
+    // Only the first attribute would be found, the other ones would be ignored
+    static_assert(Reflection::IsPlainDescriptor<DescriptorT> || Reflection::CountAttributes<Reflection::StyleColor, DescriptorT>() <= 1,
+        "A member can only have one StyleColor attribute, set all its colors in it");
+    // The former StyleVar<float_t> and StyleVar<ImVec2> attributes are each counted on their own, a field could set both
+    if constexpr (!Reflection::IsPlainDescriptor<DescriptorT>)
+    {
+        constexpr size_t legacyFloatCount = Reflection::CountAttributes<Reflection::StyleVar<float_t>, DescriptorT>();
+        constexpr size_t legacyVectorCount = Reflection::CountAttributes<Reflection::StyleVar<ImVec2>, DescriptorT>();
+        static_assert(Reflection::CountAttributes<Reflection::StyleVar, DescriptorT>() - legacyFloatCount - legacyVectorCount <= 1,
+            "A member can only have one StyleVar attribute, set all its values in it");
+        static_assert(legacyFloatCount <= 1 && legacyVectorCount <= 1,
+            "A member can only have one StyleVar<float_t> and one StyleVar<ImVec2> attribute");
+    }
+
+    // Apply color styles, only the colors that are set are stored in the attribute
     if constexpr (Reflection::HasAttribute<Reflection::StyleColor, DescriptorT>())
     {
-        constexpr Reflection::StyleColor styleColor = Reflection::GetAttribute<Reflection::StyleColor, DescriptorT>();
-        for (size_t i = 0; i < styleColor.values.size(); i++)
-        {
-            if (styleColor.values[i].has_value())
-            {
-                ImGui::PushStyleColor(static_cast<int32_t>(i), styleColor.values[i].value());
-                styleInfo.first++;
-            }
-        }
+        constexpr auto styleColor = Reflection::GetAttribute<Reflection::StyleColor, DescriptorT>();
+        for (const auto& [index, value] : styleColor.values)
+            ImGui::PushStyleColor(index, value);
+
+        styleInfo.first += static_cast<int32_t>(styleColor.values.size());
     }
 
-    // Apply float var styles
-    if constexpr (Reflection::HasAttribute<Reflection::StyleVar<float_t>, DescriptorT>())
+    // Apply var styles, the same way, from every StyleVar attribute since the former spelling can use two of them
+    if constexpr (Reflection::HasAttribute<Reflection::StyleVar, DescriptorT>())
     {
-        constexpr Reflection::StyleVar<float_t> styleVar = Reflection::GetAttribute<Reflection::StyleVar<float_t>, DescriptorT>();
-        for (size_t i = 0; i < styleVar.values.size(); i++)
+        std::apply([&styleInfo](const auto&... attributes)
         {
-            if (styleVar.values[i].has_value())
+            const auto push = [&styleInfo]<typename AttributeT>(const AttributeT& styleVar)
             {
-                ImGui::PushStyleVar(static_cast<int32_t>(i), styleVar.values[i].value());
-                styleInfo.second++;
-            }
-        }
-    }
+                if constexpr (Meta::IsSpecializationOf<Reflection::StyleVar, AttributeT>)
+                {
+                    for (size_t i = 0; i < styleVar.floatCount; i++)
+                        ImGui::PushStyleVar(styleVar.floatValues[i].first, styleVar.floatValues[i].second);
+
+                    for (size_t i = 0; i < styleVar.vectorCount; i++)
+                        ImGui::PushStyleVar(styleVar.vectorValues[i].first, styleVar.vectorValues[i].second);
+
+                    styleInfo.second += static_cast<int32_t>(styleVar.floatCount + styleVar.vectorCount);
+                }
+            };
 
-    // Apply ImVec2 var styles
-    if constexpr (Reflection::HasAttribute<Reflection::StyleVar<ImVec2>, DescriptorT>())
-    {
-        constexpr Reflection::StyleVar<ImVec2> styleVar = Reflection::GetAttribute<Reflection::StyleVar<ImVec2>, DescriptorT>();
-        for (size_t i = 0; i < styleVar.values.size(); i++)
-        {
-            if (styleVar.values[i].has_value())
-            {
-                ImGui::PushStyleVar(static_cast<int32_t>(i), styleVar.values[i].value());
-                styleInfo.second++;
-            }
-        }
+            (push(attributes), ...);
+        }, DescriptorT::attributes);
     }
 
     return styleInfo;
@@ -497,11 +3092,28 @@ std::pair<int32_t, int32_t> TypeRenderer::CheckUpdateStyle(const Metadata<Reflec
 template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
 bool_t TypeRenderer::DisplaySimpleMember(const Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata)
 {
-    ImGui::PushID(metadata.obj);
-    const std::pair<int32_t, int32_t> styleInfo = CheckUpdateStyle(metadata);
+    ImGui::PushID(metadata.name);
+    TYPE_RENDERER_STAT_ADD(ids, 1);
+    TYPE_RENDERER_STAT_ADD(values, 1);
+    const std::pair<int32_t, int32_t> styleInfo = CheckUpdateStyle<DescriptorT, Depth>();
+
+    // The address of an element can change, so the members of a reflected element aren't journaled, the container records the element edits itself
+    ChangeContext& context = GetChangeContext();
+    const bool_t journal = context.journal;
+    if constexpr (Depth == ElementDepth)
+        context.journal = false;
+
+    // Nested reflected fields that are displayed while filtering contain a match, so their tree node is opened to show it
+    if constexpr (IsFlattened<MemberT> && Depth == 0)
+    {
+        if (GetChangeContext().visible)
+            ImGui::SetNextItemOpen(true);
+    }
 
     const bool_t changed = TypeRendererImpl<MemberT>::template Render<ReflectT, DescriptorT>(metadata);
 
+    context.journal = journal;
+
     ImGui::PopStyleColor(styleInfo.first);
     ImGui::PopStyleVar(styleInfo.second);
     ImGui::PopID();
@@ -509,6 +3121,69 @@ bool_t TypeRenderer::DisplaySimpleMember(const Metadata<ReflectT, MemberT, Descr
     return changed;
 }
 
+template <typename ReflectT, typename MemberT, typename DescriptorT, size_t Depth>
+bool_t TypeRenderer::DisplayStagedMember(const Metadata<ReflectT, const MemberT, DescriptorT, Depth>& metadata, StagedElement<MemberT>& staged)
+{
+    constexpr bool_t cheapCopy = Meta::IsTriviallyCopyable<MemberT>;
+
+    const MemberT& element = *metadata.obj;
+    bool_t isStaged = staged.staging && staged.original == element;
+
+    MAYBE_UNUSED MemberT copy;
+    MemberT* obj;
+    if (isStaged)
+    {
+        obj = &staged.edited;
+    }
+    else if constexpr (cheapCopy)
+    {
+        copy = element;
+        obj = &copy;
+    }
+    else
+    {
+        // Read only, so the element is never written to
+        obj = const_cast<MemberT*>(&element);
+    }
+
+    const Metadata<ReflectT, MemberT, DescriptorT, Depth> elementMetadata = {
+        .topLevelObj = metadata.topLevelObj,
+        .name = metadata.name,
+        .obj = obj,
+    };
+
+    const bool_t readOnly = !cheapCopy && !isStaged;
+    if (readOnly)
+        ImGui::PushItemFlag(ImGuiItemFlags_ReadOnly, true);
+
+    const bool_t changed = DisplaySimpleMember(elementMetadata);
+
+    if (readOnly)
+        ImGui::PopItemFlag();
+
+    if (!isStaged)
+    {
+        if (!changed && !(readOnly && ImGui::IsItemActivated()))
+            return false;
+
+        // Start editing this element
+        staged.staging = true;
+        staged.original = element;
+        staged.edited = *obj;
+    }
+
+    // Widgets such as checkboxes and combos can be activated and deactivated in the same frame, or change without being active
+    // ImGui only reports deactivations for items that were active in the previous frame, so an inactive item ends the edit too
+    if (!ImGui::IsItemDeactivated() && ImGui::IsItemActive())
+        return false;
+
+    if (!(staged.edited == element))
+        return true;
+
+    staged.staging = false;
+    return false;
+}
+
 #pragma endregion
 
 #pragma region Type implementation
@@ -519,7 +3194,23 @@ bool_t TypeRendererImpl<MemberT, Condition>::Render(const TypeRenderer::Metadata
 {
     if constexpr (Reflection::IsReflected<MemberT>)
     {
-        return TypeRenderer::RenderType<MemberT>(metadata.obj);
+        // Elements of containers and pairs already have their own header, only fields get a tree node
+        if constexpr (Meta::IsSame<Reflection::GetMemberT<DescriptorT>, MemberT>)
+        {
+            constexpr ImGuiTreeNodeFlags flags = Reflection::HasAttribute<Reflection::Expanded, DescriptorT>() ? ImGuiTreeNodeFlags_DefaultOpen : ImGuiTreeNodeFlags_None;
+
+            // Collapsed members only submit their header
+            if (!ImGui::TreeNodeEx(metadata.name, flags))
+                return false;
+
+            const bool_t changed = TypeRenderer::RenderMembers<MemberT>(metadata.obj);
+            ImGui::TreePop();
+            return changed;
+        }
+        else
+        {
+            return TypeRenderer::RenderMembers<MemberT>(metadata.obj);
+        }
     }
     else
     {
@@ -532,29 +3223,7 @@ template <typename MemberT>
 template <typename ReflectT, typename DescriptorT, size_t Depth>
 bool_t TypeRendererImpl<MemberT, Meta::EnableIf<Meta::IsIntegralNumericOrFloating<MemberT>>>::Render(const TypeRenderer::Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata)
 {
-    uint32_t type;
-
-    // Get imgui data type based on the member type
-    if constexpr (Meta::IsSame<MemberT, int64_t>)
-        type = ImGuiDataType_S64;
-    else if constexpr (Meta::IsSame<MemberT, uint64_t>)
-        type = ImGuiDataType_U64;
-    else if constexpr (Meta::IsSame<MemberT, int32_t>)
-        type = ImGuiDataType_S32;
-    else if constexpr (Meta::IsSame<MemberT, uint32_t>)
-        type = ImGuiDataType_U32;
-    else if constexpr (Meta::IsSame<MemberT, int16_t>)
-        type = ImGuiDataType_S16;
-    else if constexpr (Meta::IsSame<MemberT, uint16_t>)
-        type = ImGuiDataType_U16;
-    else if constexpr (Meta::IsSame<MemberT, int8_t>)
-        type = ImGuiDataType_S8;
-    else if constexpr (Meta::IsSame<MemberT, uint8_t>)
-        type = ImGuiDataType_U8;
-    else if constexpr (Meta::IsSame<MemberT, float_t>)
-        type = ImGuiDataType_Float;
-    else if constexpr (Meta::IsSame<MemberT, double_t>)
-        type = ImGuiDataType_Double;
+    constexpr ImGuiDataType type = GetDataType<MemberT>();
 
     using Range = Reflection::Range<MemberT>;
     using DynamicRange = Reflection::DynamicRange<ReflectT, MemberT>;
@@ -589,93 +3258,316 @@ bool_t TypeRendererImpl<MemberT, Meta::EnableIf<Meta::IsIntegralNumericOrFloatin
 
 template <typename MemberT>
 template <typename ReflectT, typename DescriptorT, size_t Depth>
-bool_t TypeRendererImpl<MemberT, Meta::EnableIf<ContainerDefinition<MemberT>::Flags & ItDefFlags::Exists && !(ContainerDefinition<MemberT>::Flags & ItDefFlags::KeyValuePair)>>::Render(const TypeRenderer::Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata)
+bool_t TypeRendererImpl<MemberT, Meta::EnableIf<FusedDefinition<MemberT>::Count != 0>>::Render(const TypeRenderer::Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata)
+{
+    using FusedDef = FusedDefinition<MemberT>;
+    using ComponentType = typename FusedDef::ComponentType;
+    using Range = Reflection::Range<ComponentType>;
+
+    static_assert(!Reflection::HasAttribute<Reflection::PageSize, DescriptorT>() && !Reflection::HasAttribute<Reflection::Summary, DescriptorT>(),
+        "Arrays of 2 to 4 numbers are rendered with a single widget, they can't have the PageSize or Summary attributes");
+
+    constexpr ImGuiDataType type = GetDataType<ComponentType>();
+    constexpr int32_t count = static_cast<int32_t>(FusedDef::Count);
+
+    // A single widget edits all the components
+    std::array<ComponentType, FusedDef::Count> components;
+    FusedDef::Load(metadata.obj, components);
+
+    bool_t changed;
+    if constexpr (Reflection::HasAttribute<Range, DescriptorT>())
+    {
+        constexpr Range range = Reflection::GetAttribute<Range, DescriptorT>();
+        changed = ImGui::SliderScalarN(metadata.name, type, components.data(), count, &range.minimum, &range.maximum);
+    }
+    else
+    {
+        changed = ImGui::DragScalarN(metadata.name, type, components.data(), count, .1f);
+    }
+
+    if (changed)
+        FusedDef::Store(metadata.obj, components);
+
+    return changed;
+}
+
+template <typename MemberT>
+template <typename ReflectT, typename DescriptorT, size_t Depth>
+bool_t TypeRendererImpl<MemberT, Meta::EnableIf<ContainerDefinition<MemberT>::Flags & ItDefFlags::Exists && !(ContainerDefinition<MemberT>::Flags & ItDefFlags::KeyValuePair) && FusedDefinition<MemberT>::Count == 0>>::Render(const TypeRenderer::Metadata<ReflectT, MemberT, DescriptorT, Depth>& metadata)
 {
     using ItDef = ContainerDefinition<MemberT>;
     using ValueType = typename ItDef::ValueType;
+    using Iterator = typename ItDef::Iterator;
 
     constexpr bool_t isMutable = ItDef::Flags & ItDefFlags::Mutable;
+    constexpr bool_t constElements = ItDef::Flags & ItDefFlags::ConstElements;
+
+    // Element being edited, for containers whose elements can't be modified in place
+    MAYBE_UNUSED const ImGuiID stagedId = ImGui::GetID("##staged");
 
     if (!ImGui::CollapsingHeader(metadata.name))
+    {
+        if constexpr (constElements)
+            TypeRenderer::ReleaseWidgetState<TypeRenderer::StagedElement<ValueType>>(stagedId);
         return false;
+    }
 
     using AddCallback = Reflection::ContainerAddCallback<ReflectT, ValueType>;
     constexpr bool_t hasAddCallback = Reflection::HasAttribute<AddCallback, DescriptorT>();
+
+    // Elements of ordered containers are default constructed on insertion, and then placed wherever their value goes
+    static_assert(!constElements || !hasAddCallback, "ContainerAddCallback can't be used on containers with immutable elements");
+
+    TYPE_RENDERER_STAT_ADD(containers, 1);
     
     bool_t changed = false;
+    const size_t listSize = ItDef::GetSize(metadata.obj);
+    const bool_t journal = TypeRenderer::IsJournaled();
+
+    // Mutations are recorded and only applied once all the elements have been rendered, all at once
+    // This avoids invalidating the element being rendered, and shifting the elements once per operation
+    MAYBE_UNUSED std::vector<ContainerOperation> operations;
+
     if constexpr (isMutable)
     {
         if (ImGui::Button("Add element"))
+            operations.push_back({ .type = ContainerOperationType::Insert, .index = listSize });
+    }
+
+    TypeRenderer::ElementsState& elementsState = TypeRenderer::CheckEvictElementsState(listSize);
+
+    if constexpr (Reflection::HasAttribute<Reflection::Summary, DescriptorT>())
+    {
+        static_assert(Meta::IsIntegralNumericOrFloating<ValueType>, "Summary attribute can only be used on containers of integral numeric types, or floating types");
+        static_assert(std::contiguous_iterator<Iterator>, "Summary attribute can only be used on contiguous containers");
+
+        constexpr size_t binCount = Reflection::GetAttribute<Reflection::Summary, DescriptorT>().binCount;
+        TypeRenderer::DisplaySummary(std::to_address(ItDef::Begin(metadata.obj)), listSize, binCount);
+    }
+
+    // Element whose edit is done, for containers whose elements can't be modified in place
+    MAYBE_UNUSED Iterator commitIt = ItDef::End(metadata.obj);
+
+    // Jump to index field, only displayed for big containers
+    // The requested index is kept in the window storage so that it persists between frames
+    int32_t* const jumpIndex = ImGui::GetStateStorage()->GetIntRef(ImGui::GetID("##jumpIndex"), 0);
+    bool_t jump = false;
+    if (listSize > TypeRenderer::JumpToIndexMinSize)
+    {
+        jump = ImGui::InputInt("Jump to index", jumpIndex, 0, 0, ImGuiInputTextFlags_EnterReturnsTrue);
+        *jumpIndex = std::clamp(*jumpIndex, 0, static_cast<int32_t>(listSize - 1));
+    }
+
+    // The elements are reached through a cursor that only moves forward, the rows are visited in order
+    // so containers without random access are walked at most once per frame
+    Iterator cursor = ItDef::Begin(metadata.obj);
+    size_t cursorIndex = 0;
+
+    const auto renderRow = [&](const int32_t row)
+    {
+        const size_t i = static_cast<size_t>(row);
+
+        if (i < cursorIndex)
         {
-            ItDef::AddElement(metadata.obj);
-            changed = true;
+            cursor = ItDef::Begin(metadata.obj);
+            cursorIndex = 0;
+        }
 
-            if constexpr (hasAddCallback)
+        std::advance(cursor, static_cast<ptrdiff_t>(i - cursorIndex));
+        cursorIndex = i;
+
+        if (jump && row == *jumpIndex)
+            ImGui::SetScrollHereY();
+
+        // Rows use their index as an ID, this keeps the IDs stable when the container storage moves
+        ImGui::PushID(row);
+        TYPE_RENDERER_STAT_ADD(ids, 1);
+        TYPE_RENDERER_STAT_ADD(elements, 1);
+        TypeRenderer::PushElementState(elementsState, i);
+
+        if constexpr (isMutable)
+        {
+            // Button to delete the current element
+            if (ImGui::Button("-"))
+                operations.push_back({ .type = ContainerOperationType::Remove, .index = i });
+
+            ImGui::SameLine();
+
+            // Button to insert an element at the current position, the position is meaningless for ordered containers
+            if constexpr (!constElements)
+            {
+                if (ImGui::Button("+"))
+                    operations.push_back({ .type = ContainerOperationType::Insert, .index = i });
+
+                ImGui::SameLine();
+            }
+        }
+
+        char_t name[TypeRenderer::LabelBufferSize];
+        TypeRenderer::FormatIndex(name, i);
+        // Fused types are displayed on a single line, so they don't need a header either
+        if constexpr (!IsTrivialType<ValueType> && FusedDefinition<ValueType>::Count == 0)
+        {
+            if (!ImGui::CollapsingHeader(name))
             {
-                ValueType& last = ItDef::GetElement(metadata.obj, ItDef::GetSize(metadata.obj) - 1);
-                (metadata.topLevelObj->*Reflection::GetAttribute<AddCallback, DescriptorT>().func)(last);
+                TypeRenderer::PopElementState(elementsState);
+                ImGui::PopID();
+                return;
             }
         }
+
+        if constexpr (constElements)
+        {
+            const TypeRenderer::Metadata<ReflectT, const ValueType, DescriptorT, TypeRenderer::ElementDepth> elementMetadata = {
+                .topLevelObj = metadata.topLevelObj,
+                .name = name,
+                .obj = &*cursor,
+            };
+
+            // The edit is applied after the loop, this keeps the element in place while it's being edited
+            if (TypeRenderer::DisplayStagedMember(elementMetadata, TypeRenderer::GetWidgetState<TypeRenderer::StagedElement<ValueType>>(stagedId)))
+                commitIt = cursor;
+        }
+        else
+        {
+            const TypeRenderer::Metadata<ReflectT, ValueType, DescriptorT, TypeRenderer::ElementDepth> elementMetadata = {
+                .topLevelObj = metadata.topLevelObj,
+                .name = name,
+                .obj = &*cursor,
+            };
+
+            // Elements are located by index, inserting elements can move them
+            Journal::ValueEdit<ValueType> edit(journal, *cursor);
+            const bool_t elementChanged = TypeRenderer::DisplaySimpleMember(elementMetadata);
+            edit.End(*cursor, elementChanged, [&] { return ElementLocator<MemberT>{ metadata.obj, i }; });
+            changed |= elementChanged;
+        }
+
+        TypeRenderer::PopElementState(elementsState);
+        ImGui::PopID();
+    };
+
+    if constexpr (Reflection::HasAttribute<Reflection::PageSize, DescriptorT>())
+    {
+        // Only the elements of the current page are rendered, unlike clipping this doesn't depend on the height of the elements
+        constexpr size_t pageSize = Reflection::GetAttribute<Reflection::PageSize, DescriptorT>().size;
+        const auto [first, last] = TypeRenderer::DisplayPageNavigation(listSize, pageSize, jump ? *jumpIndex : -1);
+        for (size_t i = first; i < last; i++)
+            renderRow(static_cast<int32_t>(i));
+    }
+    else
+    {
+        // Only submit the elements that are visible, the height of the first element is used for the ones that are clipped
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int32_t>(listSize));
+
+        if (jump)
+            clipper.IncludeItemByIndex(*jumpIndex);
+
+        while (clipper.Step())
+        {
+            for (int32_t row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                renderRow(row);
+        }
+
+        clipper.End();
     }
 
-    size_t listSize = ItDef::GetSize(metadata.obj);
-    for (size_t i = 0; i < listSize; i++)
+    // Removing the element being edited cancels the edit
+    MAYBE_UNUSED bool_t commit = false;
+    if constexpr (constElements)
     {
-        if constexpr (isMutable)
+        if (commitIt != ItDef::End(metadata.obj))
         {
-            ImGui::PushID(&i + i);
-            // Button to delete the current element
-            if (ImGui::Button("-"))
+            const size_t commitIndex = static_cast<size_t>(std::distance(ItDef::Begin(metadata.obj), commitIt));
+            commit = std::ranges::none_of(operations, [&](const ContainerOperation& operation)
+            {
+                return operation.type == ContainerOperationType::Remove && operation.index == commitIndex;
+            });
+
+            if (!commit)
+                TypeRenderer::GetWidgetState<TypeRenderer::StagedElement<ValueType>>(stagedId).staging = false;
+        }
+    }
+
+    if constexpr (isMutable)
+    {
+        if (!operations.empty())
+        {
+            // The removed elements are moved to the journal before the operations are applied
+            // The entries are applied one after the other, so their indices take the previous operations of the batch into account
+            std::vector<std::unique_ptr<Journal::Delta>> deltas;
+            if (journal)
             {
-                ItDef::Remove(metadata.obj, i);
-                --listSize;
-                changed = true;
-
-                // Check for special cases :
-                // - The element we deleted was the only one in the list, so the list is now empty
-                // - The element we deleted was the last one in the list, so we don't have anything else to process
-                if (listSize == 0 || i == listSize)
+                std::ranges::stable_sort(operations, {}, &ContainerOperation::index);
+
+                ptrdiff_t shift = 0;
+                for (const ContainerOperation& operation : operations)
                 {
-                    ImGui::PopID();
-                    break;
+                    if (operation.index > listSize || (operation.type == ContainerOperationType::Remove && operation.index == listSize))
+                        continue;
+
+                    const size_t index = operation.index + shift;
+                    if constexpr (constElements)
+                    {
+                        // Insertions are recorded once their value is known
+                        if (operation.type == ContainerOperationType::Remove)
+                            deltas.push_back(std::make_unique<Journal::SetElementDelta<MemberT>>(metadata.obj, *std::next(ItDef::Begin(metadata.obj), static_cast<ptrdiff_t>(operation.index)), false));
+                    }
+                    else if (operation.type == ContainerOperationType::Insert)
+                    {
+                        deltas.push_back(std::make_unique<Journal::SequenceDelta<MemberT>>(metadata.obj, index, ValueType(), true));
+                        shift++;
+                    }
+                    else
+                    {
+                        ValueType& removed = *std::next(ItDef::Begin(metadata.obj), static_cast<ptrdiff_t>(operation.index));
+                        deltas.push_back(std::make_unique<Journal::SequenceDelta<MemberT>>(metadata.obj, index, std::move(removed), false));
+                        shift--;
+                    }
                 }
             }
 
-            ImGui::SameLine();
+            std::vector<Iterator> inserted;
+            ApplyContainerOperations<MemberT>(metadata.obj, operations, inserted);
+            changed = true;
 
-            // Handle inserting elements
-            if (ImGui::Button("+"))
+            if constexpr (hasAddCallback)
             {
-                // Insert a new element at the given position
-                ItDef::Insert(metadata.obj, i);
-                ++listSize;
-                changed = true;
+                for (const Iterator& it : inserted)
+                {
+                    TYPE_RENDERER_STAT_CALLBACK_SCOPE();
+                    (metadata.topLevelObj->*Reflection::GetAttribute<AddCallback, DescriptorT>().func)(*it);
+                }
+            }
 
-                if constexpr (hasAddCallback)
+            if (journal)
+            {
+                if constexpr (constElements)
                 {
-                    (metadata.topLevelObj->*Reflection::GetAttribute<AddCallback, DescriptorT>().func)(ItDef::GetElement(metadata.obj, i));
+                    for (const Iterator& it : inserted)
+                        deltas.push_back(std::make_unique<Journal::SetElementDelta<MemberT>>(metadata.obj, *it, true));
                 }
+
+                // The batch is undone at once
+                for (size_t i = 0; i < deltas.size(); i++)
+                    Journal::Record(std::move(deltas[i]), 0, i > 0);
             }
-                
-            ImGui::PopID();
-            ImGui::SameLine();
         }
+    }
 
-        ValueType& v = ItDef::GetElement(metadata.obj, i);
-        const std::string name = std::to_string(i);
-        if constexpr (!IsTrivialType<ValueType>)
+    // The edited element is changed last, node based containers keep their iterators valid when other elements are inserted or removed
+    if constexpr (constElements)
+    {
+        if (commit)
         {
-            if (!ImGui::CollapsingHeader(name.c_str()))
-                continue;
+            TypeRenderer::StagedElement<ValueType>& staged = TypeRenderer::GetWidgetState<TypeRenderer::StagedElement<ValueType>>(stagedId);
+            ValueType previous = *commitIt;
+            if (ItDef::ChangeElement(metadata.obj, commitIt, staged.edited) && journal)
+                Journal::Record(std::make_unique<Journal::RenameDelta<MemberT>>(metadata.obj, std::move(previous), staged.edited));
+            staged.staging = false;
+            changed = true;
         }
-
-        const TypeRenderer::Metadata<ReflectT, ValueType, DescriptorT, Depth + 1> elementMetadata = {
-            .topLevelObj = metadata.topLevelObj,
-            .name = name.c_str(),
-            .obj = &v,
-        };
-
-        changed |= TypeRenderer::DisplaySimpleMember(elementMetadata);
     }
 
     return changed;
@@ -689,95 +3581,275 @@ bool_t TypeRendererImpl<MemberT, Meta::EnableIf<ContainerDefinition<MemberT>::Fl
     using KeyType = typename ItDef::KeyType;
     using ValueType = typename ItDef::ValueType;
 
+    // Cached list of the keys, sorted when possible
+    // This keeps the order of the rows stable when the map rehashes, and allows clipping the rows
+    struct KeyIndex
+    {
+        // Map layout when the index was built, the index is only rebuilt when it changes
+        size_t size = 0;
+        size_t bucketCount = 0;
+        bool_t dirty = true;
+        std::vector<KeyType> keys;
+
+        // ID of each row, derived from its key so the state of the rows follows their key when keys are inserted or renamed before them
+        std::vector<ImGuiID> ids;
+
+        // Find key field
+        KeyType searchKey;
+        int32_t searchRow = -1;
+        bool_t searchFailed = false;
+
+        // Key currently being edited, keys can't be modified in place, so only this one is copied to a side buffer
+        // The map is only modified once the edit is done, this keeps the entry in place while typing
+        TypeRenderer::StagedElement<KeyType> stagedKey;
+    };
+
+    const ImGuiID indexId = ImGui::GetID("##keyIndex");
     if (!ImGui::CollapsingHeader(metadata.name))
+    {
+        // The index is only kept while the map is displayed
+        TypeRenderer::ReleaseWidgetState<KeyIndex>(indexId);
         return false;
-    
+    }
+
+    KeyIndex& index = TypeRenderer::GetWidgetState<KeyIndex>(indexId);
     bool_t changed = false;
+    const bool_t journal = TypeRenderer::IsJournaled();
+
+    TYPE_RENDERER_STAT_ADD(containers, 1);
 
     if (ImGui::Button("Add element"))
     {
+        // Nothing is added if the default key is already used
+        const size_t previousSize = ItDef::GetSize(metadata.obj);
         ItDef::AddElement(metadata.obj);
+        if (journal && ItDef::GetSize(metadata.obj) != previousSize)
+            Journal::Record(std::make_unique<Journal::MapEntryDelta<MemberT>>(metadata.obj, KeyType(), true));
+
         changed = true;
     }
 
-    // TODO find a solution to items being reordered upon re-hashing, which causes funky stuff with ImGui
-    
-    KeyType changeOldKey;
-    KeyType changeNewKey;
-    ValueType changeValue;
-    bool_t requireChange = false;
-    size_t i = 0;
-    for (std::pair<KeyType, ValueType> pair : *metadata.obj)
-    {
-        ImGui::PushID(&i + i);
-        // Button to delete the current element
-        if (ImGui::Button("-"))
+    TypeRenderer::ElementsState& elementsState = TypeRenderer::GetElementsState();
+
+    const auto rebuildIndex = [&]
+    {
+        index.keys.clear();
+        index.keys.reserve(ItDef::GetSize(metadata.obj));
+        for (auto it = ItDef::Begin(metadata.obj); it != ItDef::End(metadata.obj); ++it)
+            index.keys.push_back(it->first);
+
+        if constexpr (Meta::IsLessThanComparable<KeyType>)
+            std::ranges::sort(index.keys);
+
+        // Keys that can't be hashed fall back to the position of the row
+        index.ids.resize(index.keys.size());
+        for (size_t i = 0; i < index.keys.size(); i++)
         {
-            ItDef::Remove(metadata.obj, pair.first);
-            changed = true;
+            if constexpr (requires { std::hash<KeyType>{}(index.keys[i]); })
+                index.ids[i] = static_cast<ImGuiID>(std::hash<KeyType>{}(index.keys[i]));
+            else if constexpr (Meta::HasUniqueObjectRepresentations<KeyType>)
+                index.ids[i] = ImHashData(&index.keys[i], sizeof(KeyType));
+            else
+                index.ids[i] = static_cast<ImGuiID>(i);
+        }
+
+        // The rows whose key no longer exists are removed, along with everything nested in them
+        std::vector<ImGuiID> sortedIds = index.ids;
+        std::ranges::sort(sortedIds);
+        std::erase_if(elementsState.rows, [&](const auto& row) { return !std::ranges::binary_search(sortedIds, static_cast<ImGuiID>(row.first)); });
+
+        index.size = ItDef::GetSize(metadata.obj);
+        index.bucketCount = ItDef::GetBucketCount(metadata.obj);
+        index.dirty = false;
+    };
+
+    if (index.dirty || index.size != ItDef::GetSize(metadata.obj) || index.bucketCount != ItDef::GetBucketCount(metadata.obj))
+        rebuildIndex();
+
+    // Find key field, the map lookup tells whether the key exists, then the row is found in the index
+    const TypeRenderer::Metadata<ReflectT, KeyType, DescriptorT, TypeRenderer::ElementDepth> searchMetadata = {
+        .topLevelObj = metadata.topLevelObj,
+        .name = "##findKey",
+        .obj = &index.searchKey,
+    };
+
+    ImGui::SetNextItemWidth(ImGui::GetWindowWidth() * .45f);
+    TypeRenderer::DisplaySimpleMember(searchMetadata);
+    ImGui::SameLine();
+    if (ImGui::Button("Find key"))
+    {
+        const auto findRow = [&index]() -> int32_t
+        {
+            typename std::vector<KeyType>::const_iterator row;
+            if constexpr (Meta::IsLessThanComparable<KeyType>)
+            {
+                row = std::ranges::lower_bound(index.keys, index.searchKey);
+                if (row != index.keys.cend() && index.searchKey < *row)
+                    row = index.keys.cend();
+            }
+            else
+            {
+                row = std::ranges::find(index.keys, index.searchKey);
+            }
+
+            return row != index.keys.cend() ? static_cast<int32_t>(row - index.keys.cbegin()) : -1;
+        };
+
+        index.searchRow = -1;
+        if (ItDef::Find(metadata.obj, index.searchKey) != ItDef::End(metadata.obj))
+        {
+            // The key can be missing from the index when an entry was replaced without changing the size of the map
+            index.searchRow = findRow();
+            if (index.searchRow == -1)
+            {
+                rebuildIndex();
+                index.searchRow = findRow();
+            }
+        }
+        else if (findRow() != -1)
+        {
+            // The index still has a key that was removed
+            index.dirty = true;
+        }
+
+        index.searchFailed = index.searchRow == -1;
+    }
+
+    if (index.searchFailed)
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled("Key not found");
+    }
+
+    const auto end = ItDef::End(metadata.obj);
+    auto removeIt = end;
+    auto renameIt = end;
+
+    const int32_t searchRow = std::exchange(index.searchRow, -1);
+
+    const auto renderRow = [&](const int32_t row)
+    {
+        if (row == searchRow)
+            ImGui::SetScrollHereY();
+
+        // Rows use the ID of their key, their widgets keep their state when other keys are inserted, removed or renamed
+        const ImGuiID id = index.ids[row];
+        ImGui::PushID(static_cast<int32_t>(id));
+        TYPE_RENDERER_STAT_ADD(ids, 1);
+        TYPE_RENDERER_STAT_ADD(elements, 1);
+        TypeRenderer::PushElementState(elementsState, id);
+
+        const auto it = ItDef::Find(metadata.obj, index.keys[row]);
+        if (it == end)
+        {
+            // The entry was removed since the index was built
+            index.dirty = true;
+            ImGui::TextDisabled("<removed>");
+            TypeRenderer::PopElementState(elementsState);
             ImGui::PopID();
-            break;
+            return;
         }
 
-        ImGui::PopID();
+        // Button to delete the current element
+        if (ImGui::Button("-"))
+            removeIt = it;
+
         ImGui::SameLine();
 
-        const KeyType oldKey = pair.first;
-        const ValueType oldValue = pair.second;
-        KeyType keyDupe = oldKey;
-        ValueType valueDupe = oldValue;
+        char_t name[TypeRenderer::LabelBufferSize];
+        TypeRenderer::FormatIndex(name, static_cast<size_t>(row));
 
-        const std::string name = std::to_string(i);
-        const TypeRenderer::Metadata<ReflectT, KeyType, DescriptorT, Depth + 1> keyMetadata = {
+        const TypeRenderer::Metadata<ReflectT, const KeyType, DescriptorT, TypeRenderer::ElementDepth> keyMetadata = {
             .topLevelObj = metadata.topLevelObj,
             .name = "",
-            .obj = &keyDupe,
+            .obj = &it->first,
         };
 
-        const TypeRenderer::Metadata<ReflectT, ValueType, DescriptorT, Depth + 1> valueMetadata = {
+        const TypeRenderer::Metadata<ReflectT, ValueType, DescriptorT, TypeRenderer::ElementDepth> valueMetadata = {
             .topLevelObj = metadata.topLevelObj,
-            .name = name.c_str(),
-            .obj = &valueDupe,
+            .name = name,
+            .obj = &it->second,
         };
 
-        ImGui::PushID(keyMetadata.obj + i);
+        // The key is changed after the loop
         ImGui::SetNextItemWidth(ImGui::GetWindowWidth() * .45f);
-        const bool_t keyChanged = TypeRenderer::DisplaySimpleMember(keyMetadata);
-        ImGui::PopID();
-
-        changed |= keyChanged;
-
-        if (keyChanged)
-        {
-            changeOldKey = oldKey;
-            changeNewKey = keyDupe;
-            changeValue = oldValue;
-            requireChange = true;
-        }
+        if (TypeRenderer::DisplayStagedMember(keyMetadata, index.stagedKey))
+            renameIt = it;
 
         ImGui::SameLine();
         ImGui::Text("|");
         ImGui::SameLine();
 
-        ImGui::PushID(valueMetadata.obj + i);
+        // Values are edited in place, and located by key, the map can rehash
         ImGui::SetNextItemWidth(ImGui::GetWindowWidth() * .45f);
+        Journal::ValueEdit<ValueType> edit(journal, it->second);
         const bool_t valueChanged = TypeRenderer::DisplaySimpleMember(valueMetadata);
+        edit.End(it->second, valueChanged, [&] { return Journal::KeyLocator<MemberT>{ metadata.obj, it->first }; });
+        changed |= valueChanged;
+        TypeRenderer::PopElementState(elementsState);
         ImGui::PopID();
+    };
 
-        changed |= valueChanged;
+    if constexpr (Reflection::HasAttribute<Reflection::PageSize, DescriptorT>())
+    {
+        // Only the rows of the current page are rendered, unlike clipping this doesn't depend on the height of the values
+        constexpr size_t pageSize = Reflection::GetAttribute<Reflection::PageSize, DescriptorT>().size;
+        const auto [first, last] = TypeRenderer::DisplayPageNavigation(index.keys.size(), pageSize, searchRow);
+        for (size_t i = first; i < last; i++)
+            renderRow(static_cast<int32_t>(i));
+    }
+    else
+    {
+        // Only submit the rows that are visible, the height of the first row is used for the ones that are clipped
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int32_t>(index.keys.size()));
+
+        if (searchRow != -1)
+            clipper.IncludeItemByIndex(searchRow);
+
+        while (clipper.Step())
+        {
+            for (int32_t row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                renderRow(row);
+        }
+
+        clipper.End();
+    }
+
+    // Remove first, changing a key can rehash the map which would invalidate the iterator
+    if (removeIt != end)
+    {
+        // Removing the entry being edited cancels the edit
+        if (removeIt == renameIt)
+        {
+            renameIt = end;
+            index.stagedKey.staging = false;
+        }
 
-        if (valueChanged)
+        if (journal)
+        {
+            // The journal keeps the node of the entry, so the value isn't copied
+            std::unique_ptr<Journal::Delta> delta = std::make_unique<Journal::MapEntryDelta<MemberT>>(metadata.obj, removeIt->first, true);
+            delta->Apply();
+            Journal::Record(std::move(delta));
+        }
+        else
         {
-            ItDef::ChangeElement(metadata.obj, keyDupe, valueDupe);
+            ItDef::Remove(metadata.obj, removeIt);
         }
-        i++;
+
+        index.dirty = true;
+        changed = true;
     }
 
-    if (requireChange)
+    if (renameIt != end)
     {
-        std::cout << "Changing from " << changeOldKey << " to " << changeNewKey << std::endl;
-        ItDef::Remove(metadata.obj, changeOldKey);
-        ItDef::ChangeElement(metadata.obj, changeNewKey, changeValue);
+        KeyType previous = renameIt->first;
+        if (ItDef::ChangeKey(metadata.obj, renameIt, index.stagedKey.edited) && journal)
+            Journal::Record(std::make_unique<Journal::RenameDelta<MemberT>>(metadata.obj, std::move(previous), index.stagedKey.edited));
+        index.stagedKey.staging = false;
+        index.dirty = true;
+        changed = true;
     }
 
     return changed;
@@ -811,15 +3883,39 @@ bool_t TypeRendererImpl<MemberT, Meta::EnableIf<Meta::IsEnum<MemberT>>>::Render(
 
         // Compute preview value, it should display as all the selected values, comma separated
         // e.g. : Value1,Value2,Value8
-        auto v = magic_enum::enum_flags_name<MemberT>(*metadata.obj, ',');
-        const char_t* previewValue;
+        // The buffer is sized at compile time to fit every name, so this never allocates
+        constexpr size_t previewSize = []
+        {
+            size_t result = sizeof("<None>");
+            for (const std::string_view name : magic_enum::enum_names<MemberT>())
+                result += name.size() + 1;
+            return result;
+        }();
+
+        std::array<char_t, previewSize> previewValue;
         if (static_cast<size_t>(*metadata.obj) == 0)
-            previewValue = "<None>";
+        {
+            std::ranges::copy("<None>", previewValue.begin());
+        }
         else
-            previewValue = v.data();
+        {
+            const size_t value = static_cast<size_t>(*metadata.obj);
+            char_t* end = previewValue.data();
+            for (size_t i = 0; i < size; i++)
+            {
+                const size_t enumValue = static_cast<size_t>(magic_enum::enum_value<MemberT>(i));
+                if (enumValue == 0 || (value & enumValue) != enumValue)
+                    continue;
+
+                if (end != previewValue.data())
+                    *end++ = ',';
+                end = std::ranges::copy(enumNames.at(i), end).out;
+            }
+            *end = '\0';
+        }
 
         // Need to do a custom combo implementation because we can select multiple values
-        if (ImGui::BeginCombo(metadata.name, previewValue))
+        if (ImGui::BeginCombo(metadata.name, previewValue.data()))
         {
             for (size_t i = 0; i < size; i++)
             {
@@ -903,7 +3999,7 @@ bool_t TypeRendererImpl<std::pair<T0, T1>>::Render(const TypeRenderer::Metadata<
     ImGui::SeparatorText(metadata.name);
     constexpr bool_t hasCustomNames = Reflection::HasAttribute<Reflection::PairName, DescriptorT>();
 
-    constexpr size_t elementDepth = Depth + 1;
+    constexpr size_t elementDepth = TypeRenderer::ElementDepth;
     
     const char_t* firstName = "First";
     if constexpr (hasCustomNames)